@@ -0,0 +1,91 @@
+#include <gp_props.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Throughput of gp_classify against the per-rune lookups it replaces.
+
+#define BENCH_RUNES (1 << 20)
+#define BENCH_ITERS 64
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fill(uint32_t *dst, uint32_t len, const uint32_t *src,
+                 uint32_t src_len)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		dst[i] = src[i % src_len];
+	}
+}
+
+static void run(const char *name, gp_runes_t runes, gp_props_t *props)
+{
+	double start = now();
+	for (int i = 0; i < BENCH_ITERS; i++) {
+		gp_classify(runes, props);
+	}
+	double bulk = now() - start;
+
+	uint32_t sink = 0;
+	start = now();
+	for (int i = 0; i < BENCH_ITERS; i++) {
+		for (uint32_t j = 0; j < runes.len; j++) {
+			sink += gp_rune_width(runes.data[j]);
+			sink += gp_rune_script(runes.data[j]);
+		}
+	}
+	double scalar = now() - start;
+
+	double total = (double)runes.len * BENCH_ITERS;
+	printf("%-6s gp_classify %8.1f Mrunes/s, per-rune %8.1f Mrunes/s (%u)\n",
+	       name, total / bulk / 1e6, total / scalar / 1e6, sink & 1);
+}
+
+int main(void)
+{
+	// "The quick brown fox jumps over the lazy dog. Café naïve über."
+	static const uint32_t latin[] = {
+	        'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r',
+	        'o', 'w', 'n', ' ', 'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p',
+	        's', ' ', 'o', 'v', 'e', 'r', ' ', 't', 'h', 'e', ' ', 'l',
+	        'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', ' ', 'C', 'a', 'f',
+	        0xe9, ' ', 'n', 'a', 0xef, 'v', 'e', ' ', 0xfc, 'b', 'e', 'r',
+	        '.', ' ',
+	};
+	// "日本語のテキストと中文文本。"
+	static const uint32_t cjk[] = {
+	        0x65e5, 0x672c, 0x8a9e, 0x306e, 0x30c6, 0x30ad, 0x30b9,
+	        0x30c8, 0x3068, 0x4e2d, 0x6587, 0x6587, 0x672c, 0x3002,
+	};
+	// "hello こんにちは 你好 مرحبا שלום 👋🏽 "
+	static const uint32_t mixed[] = {
+	        'h',    'e',    'l',    'l',    'o',    ' ',    0x3053, 0x3093,
+	        0x306b, 0x3061, 0x306f, ' ',    0x4f60, 0x597d, ' ',    0x0645,
+	        0x0631, 0x062d, 0x0628, 0x0627, ' ',    0x05e9, 0x05dc, 0x05d5,
+	        0x05dd, ' ',    0x1f44b, 0x1f3fd, ' ',
+	};
+
+	uint32_t *data = malloc(sizeof(uint32_t) * BENCH_RUNES);
+	gp_props_t *props = malloc(sizeof(gp_props_t) * BENCH_RUNES);
+	gp_runes_t runes = {data, BENCH_RUNES};
+
+	fill(data, BENCH_RUNES, latin, sizeof(latin) / sizeof(*latin));
+	run("latin", runes, props);
+	fill(data, BENCH_RUNES, cjk, sizeof(cjk) / sizeof(*cjk));
+	run("cjk", runes, props);
+	fill(data, BENCH_RUNES, mixed, sizeof(mixed) / sizeof(*mixed));
+	run("mixed", runes, props);
+
+	free(data);
+	free(props);
+	return 0;
+}
@@ -243,6 +243,295 @@ func buildWidthEnum(ea [][]string) string {
 	return out.String()
 }
 
+// Grapheme_Cluster_Break values in the order of enum gp_gcb. Extended_Pictographic
+// is not a GCB value but every pictographic rune is GCB=Other, so it is
+// folded in as its own value to keep lookups to a single table.
+var gcbNames = []string{
+	"Other",
+	"CR",
+	"LF",
+	"Control",
+	"Extend",
+	"ZWJ",
+	"Regional_Indicator",
+	"Prepend",
+	"SpacingMark",
+	"L",
+	"V",
+	"T",
+	"LV",
+	"LVT",
+	"Extended_Pictographic",
+}
+
+func buildGcbEnum() string {
+	var out strings.Builder
+	fmt.Fprintf(&out, "enum gp_gcb {\n")
+	for _, n := range gcbNames {
+		fmt.Fprintf(&out, "\tGP_GCB_%s,\n", strings.ToUpper(n))
+	}
+	fmt.Fprintf(&out, "};\n")
+	return out.String()
+}
+
+// Runes itemization never splits runs on. pango uses unicode type
+// control/format/surrogate/linesep/parasep/spacesep along with 0x1680u
+// (whitespace in ucd 11).
+var spaceSpans = []span{
+	{0x0009, 0x000D}, {0x0020, 0x0020}, {0x0085, 0x0085}, {0x00A0, 0x00A0},
+	{0x1680, 0x1680}, {0x2000, 0x200D}, {0x2028, 0x2029}, {0x202F, 0x202F},
+	{0x205F, 0x205F}, {0x3000, 0x3000},
+}
+
+var selectorSpans = []span{{0xFE00, 0xFE0F}, {0xE0100, 0xE01EF}}
+
+// Flag bits of the props trie, see GP_PROPS_SPACE, GP_PROPS_SELECTOR and
+// GP_PROPS_EMOJI.
+const (
+	propsSpace    = 0x0800
+	propsSelector = 0x1000
+	propsEmoji    = 0x2000
+)
+
+// Number of low rune bits indexing into a trie block.
+const trieShift = 7
+
+// Set the mask bits of vals for every rune covered by f to valueOf(prop),
+// so several properties can share one trie.
+func fillValues(vals []uint16, f []field, mask uint16, valueOf func(string) (uint16, bool)) {
+	for _, e := range f {
+		v, ok := valueOf(e.prop[0])
+		if !ok {
+			log.Fatalf("no trie value for %s", e.prop[0])
+		}
+		for r := e.span.low; r <= e.span.high; r++ {
+			vals[r] = vals[r]&^mask | v
+		}
+	}
+}
+
+func cType(max int) string {
+	if max > 0xFF {
+		return "uint16_t"
+	}
+	return "uint8_t"
+}
+
+// Build a two stage lookup table. The rune's high bits pick a block from
+// the index and identical blocks are shared, which collapses the large
+// unassigned and single valued ranges of the codespace.
+func buildTrie(tabName string, vals []uint16) string {
+	const blockLen = 1 << trieShift
+	var index []int
+	var blocks [][]uint16
+	maxVal := 0
+	seen := make(map[string]int)
+	for b := 0; b < len(vals); b += blockLen {
+		blk := vals[b : b+blockLen]
+		key := fmt.Sprint(blk)
+		i, ok := seen[key]
+		if !ok {
+			i = len(blocks)
+			seen[key] = i
+			blocks = append(blocks, blk)
+		}
+		for _, e := range blk {
+			if int(e) > maxVal {
+				maxVal = int(e)
+			}
+		}
+		index = append(index, i)
+	}
+
+	var out strings.Builder
+	fmt.Fprintf(&out, "#define %s_SHIFT %d\n\n", strings.ToUpper(tabName), trieShift)
+	fmt.Fprintf(&out, "static const %s %s_index[] = {\n", cType(len(blocks)-1), tabName)
+	for i := 0; i < len(index); i += 16 {
+		fmt.Fprint(&out, "       ")
+		for _, e := range index[i:min(i+16, len(index))] {
+			fmt.Fprintf(&out, " %d,", e)
+		}
+		fmt.Fprint(&out, "\n")
+	}
+	fmt.Fprint(&out, "};\n\n")
+	fmt.Fprintf(&out, "static const %s %s_data[] = {\n", cType(maxVal), tabName)
+	for bi, blk := range blocks {
+		fmt.Fprintf(&out, "        // block %d\n", bi)
+		for i := 0; i < len(blk); i += 16 {
+			fmt.Fprint(&out, "       ")
+			for _, e := range blk[i : i+16] {
+				fmt.Fprintf(&out, " %d,", e)
+			}
+			fmt.Fprint(&out, "\n")
+		}
+	}
+	fmt.Fprint(&out, "};\n")
+	return out.String()
+}
+
+// Table of script enums indexed by the script id stored in the props trie.
+func buildScriptIds(sc []ucdScript) string {
+	var out strings.Builder
+	fmt.Fprintf(&out, "static const enum gp_script script_ids[] = {\n")
+	for _, s := range sc {
+		fmt.Fprintf(&out, "        GP_SCRIPT_%s,\n", strings.ToUpper(s.name))
+	}
+	fmt.Fprint(&out, "};\n")
+	return out.String()
+}
+
+// Minimal DFA recognizing the RGI emoji sequences. The language is finite,
+// so the trie of sequences is minimized by merging nodes with the same
+// transitions bottom up. Runes with identical columns share a class.
+type dfaNode struct {
+	next   map[uint]int
+	accept bool
+}
+
+func buildEmojiDFA(seqs [][]uint) string {
+	trie := []dfaNode{{next: map[uint]int{}}}
+	for _, s := range seqs {
+		n := 0
+		for _, r := range s {
+			m, ok := trie[n].next[r]
+			if !ok {
+				m = len(trie)
+				trie = append(trie, dfaNode{next: map[uint]int{}})
+				trie[n].next[r] = m
+			}
+			n = m
+		}
+		trie[n].accept = true
+	}
+
+	// State 0 is dead, 1 the start.
+	states := []dfaNode{{}}
+	seen := map[string]int{}
+	var minimize func(n int) int
+	minimize = func(n int) int {
+		runes := make([]uint, 0, len(trie[n].next))
+		for r := range trie[n].next {
+			runes = append(runes, r)
+		}
+		sort.Slice(runes, func(i, j int) bool { return runes[i] < runes[j] })
+		next := map[uint]int{}
+		key := fmt.Sprint(trie[n].accept)
+		for _, r := range runes {
+			next[r] = minimize(trie[n].next[r])
+			key += fmt.Sprintf(",%x:%d", r, next[r])
+		}
+		if i, ok := seen[key]; ok {
+			return i
+		}
+		seen[key] = len(states)
+		states = append(states, dfaNode{next: next, accept: trie[n].accept})
+		return len(states) - 1
+	}
+	start := minimize(0)
+	// Renumber breadth first from the start state.
+	order := []int{start}
+	ids := map[int]int{start: 1}
+	for i := 0; i < len(order); i++ {
+		n := states[order[i]]
+		runes := make([]uint, 0, len(n.next))
+		for r := range n.next {
+			runes = append(runes, r)
+		}
+		sort.Slice(runes, func(i, j int) bool { return runes[i] < runes[j] })
+		for _, r := range runes {
+			if _, ok := ids[n.next[r]]; !ok {
+				ids[n.next[r]] = len(order) + 1
+				order = append(order, n.next[r])
+			}
+		}
+	}
+
+	cols := map[uint][]int{}
+	for i, s := range order {
+		for r, m := range states[s].next {
+			if cols[r] == nil {
+				cols[r] = make([]int, len(order)+1)
+			}
+			cols[r][i+1] = ids[m]
+		}
+	}
+	var runes []uint
+	for r := range cols {
+		runes = append(runes, r)
+	}
+	sort.Slice(runes, func(i, j int) bool { return runes[i] < runes[j] })
+	// Class 0 is every rune not in a sequence.
+	classes := [][]int{nil}
+	classOf := map[string]int{}
+	var ranges []field
+	for _, r := range runes {
+		key := fmt.Sprint(cols[r])
+		c, ok := classOf[key]
+		if !ok {
+			c = len(classes)
+			classOf[key] = c
+			classes = append(classes, cols[r])
+		}
+		ranges = append(ranges, field{span: span{r, r}, prop: []string{strconv.Itoa(c)}})
+	}
+	ranges = coalesc(ranges)
+	if len(order)+1 > 0xFF || len(classes) > 0xFF {
+		log.Fatalf("emoji dfa too large: %d states %d classes", len(order)+1, len(classes))
+	}
+
+	var out strings.Builder
+	fmt.Fprintf(&out, "#define EMOJI_SEQ_STATES %d\n#define EMOJI_SEQ_CLASSES %d\n\n", len(order)+1, len(classes))
+	fmt.Fprint(&out, buildTable("emoji_seq_classes", "class", "", ranges))
+	accept := []int{0}
+	for _, s := range order {
+		if states[s].accept {
+			accept = append(accept, 1)
+		} else {
+			accept = append(accept, 0)
+		}
+	}
+	fmt.Fprint(&out, "\nstatic const bool emoji_seq_accept[EMOJI_SEQ_STATES] = {\n")
+	for i := 0; i < len(accept); i += 16 {
+		fmt.Fprint(&out, "       ")
+		for _, e := range accept[i:min(i+16, len(accept))] {
+			fmt.Fprintf(&out, " %d,", e)
+		}
+		fmt.Fprint(&out, "\n")
+	}
+	fmt.Fprint(&out, "};\n\n")
+	fmt.Fprint(&out, "static const uint8_t emoji_seq_next[EMOJI_SEQ_STATES * EMOJI_SEQ_CLASSES] = {\n")
+	for i := 0; i <= len(order); i++ {
+		fmt.Fprintf(&out, "        // state %d\n", i)
+		row := make([]int, len(classes))
+		for c := range classes {
+			if classes[c] != nil {
+				row[c] = classes[c][i]
+			}
+		}
+		for k := 0; k < len(row); k += 16 {
+			fmt.Fprint(&out, "       ")
+			for _, e := range row[k:min(k+16, len(row))] {
+				fmt.Fprintf(&out, " %d,", e)
+			}
+			fmt.Fprint(&out, "\n")
+		}
+	}
+	fmt.Fprint(&out, "};\n")
+	return out.String()
+}
+
+func readSequences(path string) [][]uint {
+	var seqs [][]uint
+	readUCD(path, func(p []string) {
+		var s []uint
+		for _, r := range strings.Fields(p[0]) {
+			s = append(s, toUint(r))
+		}
+		seqs = append(seqs, s)
+	})
+	return seqs
+}
+
 /*
 	script_found_map := make(map[string]bool)
 	for _, e := range script {
@@ -299,6 +588,75 @@ func main() {
 	// fmt.Print(buildScriptEnum(script_names))
 	// fmt.Print(buildWidthEnum(width_names))
 
-	fmt.Print(buildWidthTable("GP_WIDTH_", width, width_map))
-	fmt.Print(buildTable("sc_table", "sc", "GP_SCRIPT_", script))
+	// https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/GraphemeBreakProperty.txt
+	gcb := readCharSetUCD("GraphemeBreakProperty.txt")
+	var emoji []span
+	// https://www.unicode.org/Public/UCD/latest/ucd/emoji/emoji-data.txt
+	readUCD("emoji-data.txt", func(p []string) {
+		switch p[1] {
+		case "Extended_Pictographic":
+			gcb = append(gcb, field{span: parseSpan(p[0]), prop: p[1:]})
+		case "Emoji_Presentation":
+			emoji = append(emoji, parseSpan(p[0]))
+		}
+	})
+	gcb_vals := make([]uint16, 0x110000)
+	fillValues(gcb_vals, gcb, 0xFF, func(p string) (uint16, bool) {
+		for i, n := range gcbNames {
+			if n == p {
+				return uint16(i), true
+			}
+		}
+		return 0, false
+	})
+
+	// Script id in the low byte, width above it and flags on top. Runes
+	// missing from the tables are Unknown and Ambiguous.
+	script_ids := make(map[string]uint16)
+	for i, s := range script_names {
+		script_ids[s.name] = uint16(i)
+	}
+	width_ids := make(map[string]uint16)
+	for i, w := range width_names {
+		width_ids[w[0]] = uint16(i) << 8
+	}
+	props_vals := make([]uint16, 0x110000)
+	for r := range props_vals {
+		props_vals[r] = script_ids["Unknown"] | width_ids["A"]
+	}
+	fillValues(props_vals, script, 0x00FF, func(p string) (uint16, bool) {
+		v, ok := script_ids[p]
+		return v, ok
+	})
+	fillValues(props_vals, width, 0xFF00, func(p string) (uint16, bool) {
+		v, ok := width_ids[p]
+		return v, ok
+	})
+
+	for _, sp := range spaceSpans {
+		for r := sp.low; r <= sp.high; r++ {
+			props_vals[r] |= propsSpace
+		}
+	}
+	for _, sp := range selectorSpans {
+		for r := sp.low; r <= sp.high; r++ {
+			props_vals[r] |= propsSelector
+		}
+	}
+	for _, sp := range emoji {
+		for r := sp.low; r <= sp.high; r++ {
+			props_vals[r] |= propsEmoji
+		}
+	}
+
+	fmt.Print(buildScriptIds(script_names))
+	fmt.Print(buildTrie("props_trie", props_vals))
+	// fmt.Print(buildGcbEnum())
+	fmt.Print(buildTrie("gcb_trie", gcb_vals))
+
+	// https://www.unicode.org/Public/emoji/latest/emoji-sequences.txt
+	// https://www.unicode.org/Public/emoji/latest/emoji-zwj-sequences.txt
+	seqs := readSequences("emoji-sequences.txt")
+	seqs = append(seqs, readSequences("emoji-zwj-sequences.txt")...)
+	fmt.Print(buildEmojiDFA(seqs))
 }
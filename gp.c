@@ -9,13 +9,31 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <assert.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "gp.h"
 #include "gp_props.h"
 
 #define UNUSED(x) (void)(x)
 
+// Glyph caches, from gp_raster.c.
+void raster_memory(gp_memory_stats_t *stats);
+void raster_trim(enum gp_trim_level level);
+
+// Font records, from gp_font.c.
+bool font_hb(uint32_t id, hb_font_t **font, hb_font_t **unscaled);
+cairo_font_options_t *font_options_for(cairo_t *cr);
+cairo_scaled_font_t *scaled_font_for(uint32_t id,
+                                     const cairo_font_options_t *options);
+void fonts_memory(gp_memory_stats_t *stats);
+void fonts_trim(void);
+
 typedef struct gp_run_iter {
 	uint32_t start;
 	uint32_t at;
@@ -25,8 +43,22 @@ typedef struct gp_run_iter {
 	enum gp_width width;
 	FcPattern *font;
 	uint32_t font_pri; // priority of current font
+	bool emoji; // font comes from fs_color
+
+	// Last font interned, runs mostly take turns between a few.
+	FcPattern *interned;
+	uint32_t interned_id;
 } gp_run_iter;
 
+uint32_t iter_font_id(gp_run_iter *iter)
+{
+	if (iter->font != iter->interned) {
+		iter->interned = iter->font;
+		iter->interned_id = gp_font_intern(iter->font);
+	}
+	return iter->interned_id;
+}
+
 bool pattern_has_rune(FcPattern *font, uint32_t rune)
 {
 	FcCharSet *cs;
@@ -50,30 +82,131 @@ FcPattern *choose_font_for(uint32_t rune, FcFontSet *fs, uint32_t *priority)
 	return NULL;
 }
 
-bool width_eql(enum gp_width l, enum gp_width r)
+// Emoji first try fs_color, fonts from fs rank after all of its fonts.
+FcPattern *choose_font_presentation(uint32_t rune, FcFontSet *fs,
+                                    FcFontSet *fs_color, bool emoji,
+                                    uint32_t *priority)
 {
-	bool lb = (l == GP_WIDTH_NEUTRAL) || (l == GP_WIDTH_NARROW) ||
-	          (l == GP_WIDTH_HALFWIDTH);
-	bool rb = (r == GP_WIDTH_NEUTRAL) || (r == GP_WIDTH_NARROW) ||
-	          (r == GP_WIDTH_HALFWIDTH);
-	return lb == rb;
+	if (!emoji || !fs_color) {
+		return choose_font_for(rune, fs, priority);
+	}
+	for (int j = 0; j < fs_color->nfont; j++) {
+		if (pattern_has_rune(fs_color->fonts[j], rune)) {
+			*priority = (uint32_t)j;
+			return fs_color->fonts[j];
+		}
+	}
+	FcPattern *font = choose_font_for(rune, fs, priority);
+	if (font) {
+		*priority += fs_color->nfont;
+	}
+	return font;
 }
 
-bool is_space(uint32_t rune)
+// Per rune presentation, see emoji_presentation.
+#define GP_EMOJI_PRESENTATION 0x1
+#define GP_EMOJI_SEQUENCE 0x2 // part of an RGI emoji sequence
+
+// Presentation of each rune, decided per grapheme cluster in logical order
+// (UTS #51). RGI emoji sequences are emoji, otherwise VS16 asks for emoji,
+// VS15 for text and Emoji_Presentation runes default to emoji.
+void emoji_presentation(gp_runes_t runes, gp_props_t *props, bool *breaks,
+                        uint8_t *emoji)
 {
-	// pango uses unicode type
-	// control/format/surrogate/linesep/parasep/spacesep
-	// along with 0x1680u (whitespace in ucd 11)
-	return (0x0009 <= rune && rune <= 0x000D) || 0x0020 == rune ||
-	       0x0085 == rune || 0x00A0 == rune || 0x1680 == rune ||
-	       (0x2000 <= rune && rune <= 0x200D) || 0x2028 == rune ||
-	       0x2029 == rune || 0x202F == rune || 0x205F == rune || 0x3000 == rune;
+	for (uint32_t at = 0, end; at < runes.len; at = end) {
+		for (end = at + 1; end < runes.len && !breaks[end]; end++) {
+		}
+		// Sequences never cross clusters, single runes arent sequences.
+		gp_runes_t cluster = {runes.data, end};
+		uint32_t seq = end - at > 1 ? gp_emoji_sequence(cluster, at) : 0;
+		bool pres = seq > 0;
+		for (uint32_t i = at; !seq && i < end; i++) {
+			if (runes.data[i] == 0xFE0F || runes.data[i] == 0xFE0E) {
+				pres = runes.data[i] == 0xFE0F;
+				break;
+			}
+			pres |= props[i] & GP_PROPS_EMOJI;
+		}
+		for (uint32_t i = at; i < end; i++) {
+			emoji[i] = (pres ? GP_EMOJI_PRESENTATION : 0) |
+			           (i < at + seq ? GP_EMOJI_SEQUENCE : 0);
+		}
+	}
 }
 
-bool is_variant_sel(uint32_t rune)
+// End of the cluster at visual position at.
+uint32_t cluster_end(bool *breaks, uint32_t len, uint32_t at)
 {
-	return (0xfe00 <= rune && rune <= 0xfe0f) ||
-	       (0xe0100 <= rune && rune <= 0xe01ef);
+	uint32_t end = at + 1;
+	while (end < len && !breaks[end]) {
+		end++;
+	}
+	return end;
+}
+
+// Every rune of the cluster from at to end, other than joiners and selectors
+// which fonts may leave to the shaper.
+bool pattern_has_cluster(FcPattern *font, gp_runes_t runes, gp_props_t *props,
+                         uint32_t at, uint32_t end)
+{
+	for (uint32_t i = at; i < end; i++) {
+		if ((props[i] & GP_PROPS_SELECTOR) || runes.data[i] == 0x200D) {
+			continue;
+		}
+		if (!pattern_has_rune(font, runes.data[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// One font for a whole emoji sequence, so families and flags dont fall
+// apart into a fallback font per rune.
+FcPattern *choose_font_cluster(gp_runes_t runes, gp_props_t *props,
+                               uint32_t at, uint32_t end, FcFontSet *fs,
+                               FcFontSet *fs_color, bool emoji,
+                               uint32_t *priority)
+{
+	FcFontSet *sets[] = {emoji && fs_color ? fs_color : fs, fs};
+	uint32_t base = 0;
+	for (uint32_t s = 0; s < 2 && (s == 0 || sets[0] != fs); s++) {
+		for (int j = 0; sets[s] && j < sets[s]->nfont; j++) {
+			if (pattern_has_cluster(sets[s]->fonts[j], runes, props, at,
+			                        end)) {
+				*priority = base + (uint32_t)j;
+				return sets[s]->fonts[j];
+			}
+		}
+		base = sets[s] ? sets[s]->nfont : 0;
+	}
+	// Nothing has all of it, settle for the first rune.
+	return choose_font_presentation(runes.data[at], fs, fs_color, emoji,
+	                                priority);
+}
+
+// Font for the cluster from visual position at to end given its
+// presentation. head is the position of its logical-first rune.
+FcPattern *choose_font_for_at(gp_runes_t runes, gp_props_t *props,
+                              uint8_t *emoji, uint32_t at, uint32_t end,
+                              uint32_t head, FcFontSet *fs,
+                              FcFontSet *fs_color, uint32_t *priority)
+{
+	bool is_emoji = fs_color && (emoji[at] & GP_EMOJI_PRESENTATION);
+	if (emoji[at] & GP_EMOJI_SEQUENCE) {
+		return choose_font_cluster(runes, props, at, end, fs, fs_color,
+		                           is_emoji, priority);
+	}
+	return choose_font_presentation(runes.data[head], fs, fs_color, is_emoji,
+	                                priority);
+}
+
+bool width_eql(enum gp_width l, enum gp_width r)
+{
+	bool lb = (l == GP_WIDTH_NEUTRAL) || (l == GP_WIDTH_NARROW) ||
+	          (l == GP_WIDTH_HALFWIDTH);
+	bool rb = (r == GP_WIDTH_NEUTRAL) || (r == GP_WIDTH_NARROW) ||
+	          (r == GP_WIDTH_HALFWIDTH);
+	return lb == rb;
 }
 
 void gp_run_destroy(gp_run_t *runs, uint32_t len)
@@ -84,60 +217,87 @@ void gp_run_destroy(gp_run_t *runs, uint32_t len)
 	free(runs);
 }
 
-void gp_itemize(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
-                FriBidiLevel *levels, gp_run_t **runs_out, uint32_t *len)
+// props are the classified runes. breaks marks the visual positions which
+// start a new grapheme cluster, runs are never split inside a cluster. heads
+// holds the visual position of the logical-first rune of each cluster, its
+// script, width, level and font stand for the cluster (in RTL text the
+// visually first rune is a trailing mark). emoji holds the presentation of
+// each rune. Runs never split a rune so there are at most runes.len of them,
+// runs must have room for runes.len + 1 (empty text still gets one). False
+// if a font couldnt be interned.
+bool gp_itemize(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                FriBidiLevel *levels, gp_props_t *props, bool *breaks,
+                uint32_t *heads, uint8_t *emoji, gp_run_t *runs,
+                uint32_t *len)
 {
 	// TODO: maintain paired chars (paren/quotes/etc)? Prefering higher priority fonts mostly fixed this.
-	UNUSED(fs_color);
-
 	gp_run_iter iter = {0};
-	gp_run_t *runs = malloc(sizeof(gp_run_t) * 256);
 	size_t r = 0;
 
 	// spaces are ambiguous skip any leading spaces.
-	while (is_space(runes.data[iter.at]) && iter.at < runes.len) {
+	while (iter.at < runes.len && (props[iter.at] & GP_PROPS_SPACE)) {
 		iter.at++;
 	}
-	iter.width = gp_rune_width(runes.data[iter.at]);
-	iter.script = gp_rune_script(runes.data[iter.at]);
-	iter.level = levels[iter.at];
-	iter.font = choose_font_for(runes.data[iter.at], fs, &iter.font_pri);
+	// All spaces still needs a font, take the first.
+	uint32_t first = iter.at < runes.len ? iter.at : 0;
+	uint32_t head = runes.len ? heads[first] : 0;
+	iter.width = GP_PROPS_WIDTH(props[head]);
+	iter.script = gp_script_from_id(GP_PROPS_SCRIPT_ID(props[head]));
+	iter.level = levels[head];
+	iter.emoji = fs_color && (emoji[first] & GP_EMOJI_PRESENTATION);
+	if (runes.len) {
+		iter.font = choose_font_for_at(
+		        runes, props, emoji, first,
+		        cluster_end(breaks, runes.len, first), head, fs, fs_color,
+		        &iter.font_pri);
+	}
 
-	for (; iter.at < runes.len; iter.at++) {
+	// A cluster is decided whole at its first rune, the rest is skipped.
+	for (uint32_t end; iter.at < runes.len; iter.at = end) {
 		bool changed = false;
-		uint32_t rune = runes.data[iter.at];
-		// Just dont break runs on whitespace.
-		// TODO: handle (emoji) variant selectors (requires another parser)
-		if (is_space(rune) || is_variant_sel(rune)) {
+		end = cluster_end(breaks, runes.len, iter.at);
+		// Just dont break runs on whitespace or inside a cluster, this
+		// keeps marks, variant selectors and emoji ZWJ sequences together.
+		if ((props[iter.at] & GP_PROPS_SPACE) || !breaks[iter.at]) {
 			continue;
 		}
+		head = heads[iter.at];
+		uint32_t rune = runes.data[head];
 
+		// Best font for the cluster, once.
+		uint32_t font_pri = 0xFFFFFFFF;
+		FcPattern *font = choose_font_for_at(runes, props, emoji, iter.at,
+		                                     end, head, fs, fs_color,
+		                                     &font_pri);
+
+		bool is_emoji = fs_color && (emoji[iter.at] & GP_EMOJI_PRESENTATION);
 		if (iter.font == NULL) {
 			// we delayed choosing font until non-space so dont mark changed.
-			iter.font = choose_font_for(rune, fs, &iter.font_pri);
+			iter.emoji = is_emoji;
+			iter.font = font;
+			iter.font_pri = font_pri;
 		}
+		changed |= iter.emoji != is_emoji;
 
-		enum gp_width width = gp_rune_width(rune);
+		enum gp_width width = GP_PROPS_WIDTH(props[head]);
 		changed |=
 		        (iter.width == GP_WIDTH_AMBIGUOUS &&
 		         !(width == GP_WIDTH_AMBIGUOUS || width == GP_WIDTH_NEUTRAL));
 
-		FcPattern *font = NULL;
-		uint32_t font_pri = 0xFFFFFFFF;
 		// Dont break for whitespace, this also helps with joiners.
-		if (iter.font != NULL) {
-			FcPattern *font_test = choose_font_for(rune, fs, &font_pri);
-			if (font_test != NULL && ((font_pri < iter.font_pri) ||
-			                          !pattern_has_rune(iter.font, rune))) {
-				changed |= true;
-				font = font_test;
-			}
+		if (iter.font != NULL && font != NULL && font != iter.font) {
+			bool has = emoji[iter.at] & GP_EMOJI_SEQUENCE
+			                   ? pattern_has_cluster(iter.font, runes, props,
+			                                         iter.at, end)
+			                   : pattern_has_rune(iter.font, rune);
+			changed |= font_pri < iter.font_pri || !has;
 		}
 
-		enum gp_script script = gp_rune_script(rune);
+		enum gp_script script =
+		        gp_script_from_id(GP_PROPS_SCRIPT_ID(props[head]));
 		changed |= iter.script != script;
 
-		int16_t level = levels[iter.at];
+		int16_t level = levels[head];
 		changed |= iter.level != level;
 
 		// Terminate current run on attribute changes or end of text.
@@ -150,7 +310,10 @@ void gp_itemize(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
 			if (iter.font == NULL) {
 				printf("run had no font???\n");
 			}
-			runs[r].font = iter.font;
+			runs[r].font = iter_font_id(&iter);
+			if (iter.font && !runs[r].font) {
+				return false;
+			}
 			runs[r].font_pri = iter.font_pri;
 
 			iter.start = iter.at;
@@ -159,11 +322,9 @@ void gp_itemize(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
 			iter.level = level;
 			iter.font = font;
 			iter.font_pri = font_pri;
-			if (font == NULL && !is_space(rune)) {
-				iter.font = choose_font_for(rune, fs, &iter.font_pri);
-			}
+			iter.emoji = is_emoji;
 			r++;
-			assert(r < 256);
+			assert(r <= runes.len);
 		}
 	}
 	runs[r].start = iter.start;
@@ -174,108 +335,1021 @@ void gp_itemize(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
 	if (iter.font == NULL) {
 		printf("run had no font???\n");
 	}
-	runs[r].font = iter.font;
+	runs[r].font = iter_font_id(&iter);
+	if (iter.font && !runs[r].font) {
+		return false;
+	}
 	runs[r].font_pri = iter.font_pri;
 
-	*runs_out = runs;
 	*len = r + 1;
+	return true;
 }
 
-void shape_runs(gp_runes_t vrunes, gp_run_t *runs, uint32_t len)
+// A font ready for shaping at a pattern's pixel size.
+typedef struct gp_shaper {
+	hb_font_t *font;
+	// At units per em for fonts whose advances scale linearly, shaped
+	// results are then cached and rescaled. NULL otherwise.
+	hb_font_t *unscaled;
+	const char *file;
+	int index;
+	int scale_x, scale_y; // scale of font
+	int upem;
+} gp_shaper;
+
+// hb-ot advances of scalable outlines scale linearly with size. Not so if
+// the rasterizer hints horizontally, the glyphs come from bitmap strikes or
+// the pattern applies its own matrix.
+bool shapes_linearly(FcPattern *pattern)
 {
-	uint32_t i = 0;
-	while (i < len) {
-		// load font tables (uses internal hb-ot functions)
-		// should use ft to share with cairo pathing
-		char *file;
-		FcPatternGetString(runs[i].font, FC_FILE, 0, (FcChar8 **)&file);
-		hb_blob_t *fileblob = hb_blob_create_from_file(file);
-		hb_face_t *face = hb_face_create(fileblob, 0);
-		hb_font_t *font = hb_font_create(face);
-
-		// Set font size during shaping, for appropriate glyph advances.
-		// add subpixel scaling factor on top since hb is integer based.
-		double size;
-		FcPatternGetDouble(runs[i].font, FC_PIXEL_SIZE, 0, &size);
-		double size_x = size, size_y = size;
-
-		// typically provided by 10-scale-bitmap-fonts.conf, maybe
-		// other fonts will have matrix factors as well. ignore
-		// "scalable" during layout, stop using bitmap text fonts.
-		FcMatrix *scale_mat;
-		if (FcPatternGetMatrix(runs[i].font, FC_MATRIX, 0, &scale_mat) ==
-		    FcResultMatch) {
-			if (scale_mat->xy != 0.0 || scale_mat->yx != 0.0) {
-				printf("Uh-oh, shear/rotate matrix detected. Rendering probably going wrong.\n");
-			}
-			size_x *= scale_mat->xx;
-			size_y *= scale_mat->yy;
+	FcBool b;
+	int style;
+	FcMatrix *mat;
+	if (FcPatternGetBool(pattern, FC_SCALABLE, 0, &b) != FcResultMatch || !b) {
+		return false;
+	}
+	if (FcPatternGetBool(pattern, FC_OUTLINE, 0, &b) == FcResultMatch && !b) {
+		return false;
+	}
+	if (FcPatternGetBool(pattern, FC_HINTING, 0, &b) == FcResultMatch && b &&
+	    (FcPatternGetInteger(pattern, FC_HINT_STYLE, 0, &style) !=
+	             FcResultMatch ||
+	     style > FC_HINT_SLIGHT)) {
+		return false;
+	}
+	if (FcPatternGetMatrix(pattern, FC_MATRIX, 0, &mat) == FcResultMatch &&
+	    (mat->xx != 1.0 || mat->xy != 0.0 || mat->yx != 0.0 ||
+	     mat->yy != 1.0)) {
+		return false;
+	}
+	return true;
+}
+
+typedef struct blob_mapping {
+	void *addr;
+	size_t len;
+} blob_mapping;
+
+void blob_unmap(void *user_data)
+{
+	blob_mapping *m = user_data;
+	munmap(m->addr, m->len);
+	free(m);
+}
+
+// Font files are mapped read-only rather than read into the heap, so every
+// process using the font shares the kernel's page cache copy.
+hb_blob_t *blob_map_file(const char *file)
+{
+	int fd = open(file, O_RDONLY | O_CLOEXEC);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+		if (fd >= 0) {
+			close(fd);
 		}
+		return hb_blob_create_from_file(file);
+	}
+	void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED) {
+		return hb_blob_create_from_file(file);
+	}
+	// Shaping touches a few tables of the file, dont read ahead the rest.
+	madvise(addr, st.st_size, MADV_RANDOM);
 
-		hb_font_set_scale(font, size_x * GP_SHAPE_SCALE,
-		                  size_y * GP_SHAPE_SCALE);
+	blob_mapping *m = malloc(sizeof(blob_mapping));
+	*m = (blob_mapping){addr, st.st_size};
+	return hb_blob_create(addr, st.st_size, HB_MEMORY_MODE_READONLY, m,
+	                      blob_unmap);
+}
 
-		hb_buffer_t *buf = hb_buffer_create();
-		//TODO: Add context from prior and next run for better shaping.
-		// Doesnt look like we can share context between buffers.
-		uint32_t run_len = runs[i].end - runs[i].start;
-		hb_buffer_add_codepoints(buf, &vrunes.data[runs[i].start], run_len, 0,
-		                         run_len);
-		hb_segment_properties_t props = {
-		        .direction = runs[i].level % 2 ? HB_DIRECTION_RTL
-		                                       : HB_DIRECTION_LTR,
-		        .script = hb_script_from_iso15924_tag((hb_tag_t)runs[i].script),
-		        //TODO: Can we do better than guessing from locale?
-		        .language = hb_language_get_default(),
-		};
-		//TODO: Use visual order instead?
-		if (props.direction == HB_DIRECTION_RTL) {
-			hb_buffer_reverse(buf);
+// Mapped font files by path. Cached blobs keep their mapping alive, evicted
+// ones are unmapped once the last face using them is gone.
+#define GP_BLOB_CACHE 32
+static struct {
+	char *file;
+	hb_blob_t *blob;
+} blobs[GP_BLOB_CACHE];
+static uint32_t blobs_next;
+static pthread_mutex_t blobs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+hb_blob_t *blob_for_file(const char *file)
+{
+	hb_blob_t *blob;
+	pthread_mutex_lock(&blobs_lock);
+	for (uint32_t i = 0; i < GP_BLOB_CACHE; i++) {
+		if (blobs[i].file && strcmp(blobs[i].file, file) == 0) {
+			blob = hb_blob_reference(blobs[i].blob);
+			pthread_mutex_unlock(&blobs_lock);
+			return blob;
 		}
-		hb_buffer_set_segment_properties(buf, &props);
+	}
+	uint32_t slot = blobs_next++ % GP_BLOB_CACHE;
+	free(blobs[slot].file);
+	hb_blob_destroy(blobs[slot].blob);
+	blobs[slot].file = strdup(file);
+	blobs[slot].blob = blob_map_file(file);
+	blob = hb_blob_reference(blobs[slot].blob);
+	pthread_mutex_unlock(&blobs_lock);
+	return blob;
+}
 
-		// Features?
-		hb_shape(font, buf, NULL, 0);
-		hb_font_destroy(font);
-		hb_face_destroy(face);
-		hb_blob_destroy(fileblob);
-		// FcStrFree((FcChar8 *)file);
-		runs[i].glyphs = buf;
-		i++;
+// Take the font's shaping objects, built once per font by gp_font.c.
+void shaper_load(gp_shaper *shaper, uint32_t font)
+{
+	const gp_font_t *f = gp_font_get(font);
+	if (!f) {
+		memset(shaper, 0, sizeof(*shaper));
+		shaper->file = "";
+		return;
+	}
+	*shaper = (gp_shaper){
+	        .file = f->file,
+	        .index = f->index,
+	        .scale_x = f->size * f->scale_x * GP_SHAPE_SCALE,
+	        .scale_y = f->size * f->scale_y * GP_SHAPE_SCALE,
+	};
+	font_hb(font, &shaper->font, &shaper->unscaled);
+	if (shaper->unscaled) {
+		shaper->upem = hb_face_get_upem(hb_font_get_face(shaper->unscaled));
 	}
 }
 
-bool gp_analyze(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
-                const char *lang, gp_run_t **runs_out, uint32_t *len)
+void shaper_release(gp_shaper *shaper)
+{
+	hb_font_destroy(shaper->font);
+	hb_font_destroy(shaper->unscaled);
+	memset(shaper, 0, sizeof(*shaper));
+}
+
+// Shaped runs at units per em, keyed by face and run contents. Direct mapped
+// so a colliding run simply replaces the older one.
+#define GP_SHAPE_CACHE 1024
+typedef struct shape_entry {
+	uint64_t hash;
+	char *file;
+	int index;
+	hb_direction_t direction;
+	hb_script_t script;
+	hb_language_t language;
+	uint32_t *text;
+	uint32_t text_len;
+	hb_glyph_info_t *infos;
+	hb_glyph_position_t *pos;
+	uint32_t len;
+} shape_entry;
+static shape_entry shape_cache[GP_SHAPE_CACHE];
+// Striped so threads laying out different text rarely share a lock.
+#define GP_SHAPE_LOCKS 64
+static pthread_mutex_t shape_cache_locks[GP_SHAPE_LOCKS];
+static pthread_once_t shape_cache_once = PTHREAD_ONCE_INIT;
+
+static void shape_cache_init(void)
+{
+	for (uint32_t i = 0; i < GP_SHAPE_LOCKS; i++) {
+		pthread_mutex_init(&shape_cache_locks[i], NULL);
+	}
+}
+
+uint64_t shape_hash(const gp_shaper *shaper,
+                    const hb_segment_properties_t *props, const uint32_t *text,
+                    uint32_t len)
+{
+	// FNV-1a
+	uint64_t h = 0xcbf29ce484222325ull;
+	for (const char *c = shaper->file; *c; c++) {
+		h = (h ^ (uint8_t)*c) * 0x100000001b3ull;
+	}
+	uint64_t words[] = {shaper->index, props->direction, props->script,
+	                    (uintptr_t)props->language};
+	for (uint32_t i = 0; i < sizeof(words) / sizeof(*words); i++) {
+		h = (h ^ words[i]) * 0x100000001b3ull;
+	}
+	for (uint32_t i = 0; i < len; i++) {
+		h = (h ^ text[i]) * 0x100000001b3ull;
+	}
+	return h;
+}
+
+bool shape_entry_matches(const shape_entry *e, uint64_t hash,
+                         const gp_shaper *shaper,
+                         const hb_segment_properties_t *props,
+                         const uint32_t *text, uint32_t len)
+{
+	return e->infos && e->hash == hash && e->index == shaper->index &&
+	       e->direction == props->direction && e->script == props->script &&
+	       e->language == props->language && e->text_len == len &&
+	       memcmp(e->text, text, sizeof(uint32_t) * len) == 0 &&
+	       strcmp(e->file, shaper->file) == 0;
+}
+
+void shape_entry_clear(shape_entry *e)
+{
+	free(e->file);
+	free(e->text);
+	free(e->infos);
+	free(e->pos);
+	memset(e, 0, sizeof(*e));
+}
+
+// Round v * num / den to the nearest integer.
+static int32_t scale_pos(int32_t v, int64_t num, int64_t den)
+{
+	int64_t x = v * num;
+	return x < 0 ? -((-x + den / 2) / den) : (x + den / 2) / den;
+}
+
+// Replace the contents of buf with already shaped glyphs.
+void set_glyphs(hb_buffer_t *buf, const hb_segment_properties_t *props,
+                const hb_glyph_info_t *infos, const hb_glyph_position_t *pos,
+                uint32_t len)
+{
+	hb_buffer_clear_contents(buf);
+	hb_buffer_pre_allocate(buf, len);
+	for (uint32_t i = 0; i < len; i++) {
+		hb_buffer_add(buf, infos[i].codepoint, infos[i].cluster);
+	}
+	hb_buffer_set_content_type(buf, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+	hb_buffer_set_segment_properties(buf, props);
+	memcpy(hb_buffer_get_glyph_infos(buf, NULL), infos,
+	       sizeof(hb_glyph_info_t) * len);
+	memcpy(hb_buffer_get_glyph_positions(buf, NULL), pos,
+	       sizeof(hb_glyph_position_t) * len);
+}
+
+// Shape at units per em through the cache and rescale into buf. hb_shape
+// runs outside the lock so threads only contend on copying entries.
+void shape_cached(gp_shaper *shaper, hb_buffer_t *buf,
+                  const hb_segment_properties_t *props, const uint32_t *text,
+                  uint32_t len)
+{
+	uint64_t hash = shape_hash(shaper, props, text, len);
+	shape_entry *e = &shape_cache[hash % GP_SHAPE_CACHE];
+	pthread_once(&shape_cache_once, shape_cache_init);
+	pthread_mutex_t *lock =
+	        &shape_cache_locks[(hash % GP_SHAPE_CACHE) % GP_SHAPE_LOCKS];
+	pthread_mutex_lock(lock);
+	bool hit = shape_entry_matches(e, hash, shaper, props, text, len);
+	if (hit) {
+		// Replace the input with the cached glyphs.
+		set_glyphs(buf, props, e->infos, e->pos, e->len);
+	}
+	pthread_mutex_unlock(lock);
+
+	uint32_t glen;
+	if (!hit) {
+		hb_shape(shaper->unscaled, buf, NULL, 0);
+		hb_glyph_info_t *infos = hb_buffer_get_glyph_infos(buf, &glen);
+		hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(buf, NULL);
+		shape_entry n = {
+		        .hash = hash,
+		        .file = strdup(shaper->file),
+		        .index = shaper->index,
+		        .direction = props->direction,
+		        .script = props->script,
+		        .language = props->language,
+		        .text = malloc(sizeof(uint32_t) * (len + 1)),
+		        .text_len = len,
+		        .infos = malloc(sizeof(hb_glyph_info_t) * (glen + 1)),
+		        .pos = malloc(sizeof(hb_glyph_position_t) * (glen + 1)),
+		        .len = glen,
+		};
+		memcpy(n.text, text, sizeof(uint32_t) * len);
+		memcpy(n.infos, infos, sizeof(hb_glyph_info_t) * glen);
+		memcpy(n.pos, pos, sizeof(hb_glyph_position_t) * glen);
+		pthread_mutex_lock(lock);
+		shape_entry_clear(e);
+		*e = n;
+		pthread_mutex_unlock(lock);
+	}
+
+	hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(buf, &glen);
+	for (uint32_t i = 0; i < glen; i++) {
+		pos[i].x_advance = scale_pos(pos[i].x_advance, shaper->scale_x,
+		                             shaper->upem);
+		pos[i].y_advance = scale_pos(pos[i].y_advance, shaper->scale_y,
+		                             shaper->upem);
+		pos[i].x_offset = scale_pos(pos[i].x_offset, shaper->scale_x,
+		                            shaper->upem);
+		pos[i].y_offset = scale_pos(pos[i].y_offset, shaper->scale_y,
+		                            shaper->upem);
+	}
+}
+
+// hb language for a locale name or BCP 47 tag ("ja_JP.UTF-8", "zh-TW"). hb
+// takes care of case and underscores, not the codeset or modifier. NULL and
+// the C locale mean the process locale.
+hb_language_t language_for(const char *lang)
+{
+	if (!lang || !*lang || strcmp(lang, "C") == 0 ||
+	    strcmp(lang, "POSIX") == 0) {
+		return hb_language_get_default();
+	}
+	return hb_language_from_string(lang, strcspn(lang, ".@"));
+}
+
+void shape_run(gp_shaper *shaper, hb_language_t language,
+               const uint32_t *vrunes, gp_run_t *run)
+{
+	hb_buffer_t *buf = hb_buffer_create();
+	//TODO: Add context from prior and next run for better shaping.
+	// Doesnt look like we can share context between buffers.
+	uint32_t run_len = run->end - run->start;
+	hb_buffer_add_codepoints(buf, &vrunes[run->start], run_len, 0, run_len);
+	hb_segment_properties_t props = {
+	        .direction = run->level % 2 ? HB_DIRECTION_RTL : HB_DIRECTION_LTR,
+	        .script = hb_script_from_iso15924_tag((hb_tag_t)run->script),
+	        .language = language,
+	};
+	//TODO: Use visual order instead?
+	if (props.direction == HB_DIRECTION_RTL) {
+		hb_buffer_reverse(buf);
+	}
+	hb_buffer_set_segment_properties(buf, &props);
+
+	// Features?
+	if (shaper->unscaled) {
+		shape_cached(shaper, buf, &props, &vrunes[run->start], run_len);
+	} else {
+		hb_shape(shaper->font, buf, NULL, 0);
+	}
+	run->glyphs = buf;
+}
+
+void shape_runs(gp_runes_t vrunes, const char *lang, gp_run_t *runs,
+                uint32_t len)
+{
+	hb_language_t language = language_for(lang);
+	// Adjacent runs often share a font (e.g. split on level), dont reload.
+	uint32_t font = 0;
+	gp_shaper shaper = {0};
+	for (uint32_t i = 0; i < len; i++) {
+		if (runs[i].font != font) {
+			shaper_release(&shaper);
+			font = runs[i].font;
+			shaper_load(&shaper, font);
+		}
+		shape_run(&shaper, language, vrunes.data, &runs[i]);
+	}
+	shaper_release(&shaper);
+}
+
+// bidi and itemize a single string. vstr receives the visual order runes,
+// v_to_l (if not NULL) the logical index of each of them.
+bool analyze_runs_map(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                      uint32_t *vstr, uint32_t *v_to_l_out, gp_run_t *runs,
+                      uint32_t *len)
 {
-	UNUSED(lang);
 	assert(runes.len < 4096); // I dont want to malloc.
-	uint32_t vstr[4096];
 	FriBidiLevel embedding[4096];
+	FriBidiStrIndex v_to_l[4096];
 	FriBidiParType base = FRIBIDI_PAR_LTR;
-	if (!fribidi_log2vis(runes.data, runes.len, &base, vstr, NULL, NULL,
+	if (!fribidi_log2vis(runes.data, runes.len, &base, vstr, NULL, v_to_l,
 	                     embedding)) {
 		return false;
 	}
 	gp_runes_t vrunes = {vstr, runes.len};
 
-	gp_run_t *runs;
-	uint32_t runs_len;
+	// Clusters are found in logical order, then carried over to visual
+	// order by comparing the cluster of visually adjacent runes.
+	bool breaks[4096];
+	uint32_t cluster[4096];
+	gp_grapheme_breaks(runes, breaks);
+	for (uint32_t i = 0, c = 0; i < runes.len; i++) {
+		c += breaks[i];
+		cluster[i] = c;
+	}
+	// Emoji too, VS16 and ZWJ sequences only read right that way around.
+	gp_props_t lprops[4096];
+	uint8_t lemoji[4096];
+	gp_classify(runes, lprops);
+	emoji_presentation(runes, lprops, breaks, lemoji);
+	for (uint32_t v = 0; v < runes.len; v++) {
+		breaks[v] = v == 0 || cluster[v_to_l[v]] != cluster[v_to_l[v - 1]];
+	}
+	// The logical-first rune of each cluster speaks for it, in RTL runs
+	// that is the visually last one.
+	uint32_t heads[4096];
+	for (uint32_t v = 0, end; v < runes.len; v = end) {
+		uint32_t head = v;
+		for (end = v + 1; end < runes.len && !breaks[end]; end++) {
+			head = v_to_l[end] < v_to_l[head] ? end : head;
+		}
+		for (uint32_t i = v; i < end; i++) {
+			heads[i] = head;
+		}
+	}
+
+	gp_props_t props[4096];
+	uint8_t emoji[4096];
+	for (uint32_t v = 0; v < runes.len; v++) {
+		props[v] = lprops[v_to_l[v]];
+		emoji[v] = lemoji[v_to_l[v]];
+	}
+
 	//TODO: cache font tables.
-	gp_itemize(vrunes, fs, fs_color, embedding, &runs, &runs_len);
+	if (!gp_itemize(vrunes, fs, fs_color, embedding, props, breaks, heads,
+	                emoji, runs, len)) {
+		return false;
+	}
+	for (uint32_t v = 0; v_to_l_out && v < runes.len; v++) {
+		v_to_l_out[v] = v_to_l[v];
+	}
+	return true;
+}
+
+bool analyze_runs(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                  uint32_t *vstr, gp_run_t *runs, uint32_t *len)
+{
+	return analyze_runs_map(runes, fs, fs_color, vstr, NULL, runs, len);
+}
 
-	shape_runs(vrunes, runs, runs_len);
+// Clusters in visual order from shaped runs. Glyph clusters are visual
+// indices within their run (RTL runs are reversed before shaping but keep
+// the indices) and ascend left to right, a cluster spans up to the next.
+void build_cluster_index(gp_runes_t runes, const uint32_t *v_to_l,
+                         gp_run_t *runs, uint32_t len,
+                         gp_cluster_index_t *index)
+{
+	uint32_t glyphs = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		glyphs += hb_buffer_get_length(runs[i].glyphs);
+	}
+	// At most one cluster per glyph.
+	*index = (gp_cluster_index_t){
+	        .x = malloc(sizeof(double) * (glyphs + 1)),
+	        .lstart = malloc(sizeof(uint32_t) * (glyphs + 1)),
+	        .lend = malloc(sizeof(uint32_t) * (glyphs + 1)),
+	        .rtl = malloc(sizeof(bool) * (glyphs + 1)),
+	        .runes_len = runes.len,
+	        .l_to_c = malloc(sizeof(uint32_t) * (runes.len + 1)),
+	        .graphemes = malloc(sizeof(bool) * (runes.len + 1)),
+	};
+	for (uint32_t l = 0; l < runes.len; l++) {
+		index->l_to_c[l] = UINT32_MAX;
+	}
+	gp_grapheme_breaks(runes, index->graphemes);
+	index->graphemes[runes.len] = true;
+
+	double x = 0.0;
+	uint32_t c = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t glen;
+		hb_glyph_info_t *info =
+		        hb_buffer_get_glyph_infos(runs[i].glyphs, &glen);
+		hb_glyph_position_t *pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, NULL);
+		uint32_t run_len = runs[i].end - runs[i].start;
+		for (uint32_t g = 0; g < glen;) {
+			uint32_t first = info[g].cluster;
+			index->x[c] = x;
+			for (; g < glen && info[g].cluster == first; g++) {
+				x += pos[g].x_advance / (double)GP_SHAPE_SCALE;
+			}
+			uint32_t next = g < glen ? info[g].cluster : run_len;
+			uint32_t lo = UINT32_MAX, hi = 0;
+			for (uint32_t v = first; v < next && v < run_len; v++) {
+				uint32_t l = v_to_l[runs[i].start + v];
+				lo = l < lo ? l : lo;
+				hi = l + 1 > hi ? l + 1 : hi;
+				index->l_to_c[l] = c;
+			}
+			if (lo == UINT32_MAX) {
+				continue; // non monotone clusters, skip the glyphs.
+			}
+			index->lstart[c] = lo;
+			index->lend[c] = hi;
+			index->rtl[c] = runs[i].level % 2;
+			c++;
+		}
+	}
+	index->x[c] = x;
+	index->len = c;
+	// Runes without glyphs of their own go with the cluster before them.
+	for (uint32_t l = 0, last = 0; l < runes.len; l++) {
+		if (index->l_to_c[l] == UINT32_MAX) {
+			index->l_to_c[l] = c ? last : 0;
+		}
+		last = index->l_to_c[l];
+	}
+}
+
+bool gp_analyze_index(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                      const char *lang, gp_run_t **runs_out, uint32_t *len,
+                      gp_cluster_index_t *index)
+{
+	assert(runes.len < 4096); // I dont want to malloc.
+	uint32_t vstr[4096];
+	uint32_t v_to_l[4096];
+	gp_run_t *runs = malloc(sizeof(gp_run_t) * (runes.len + 1));
+	uint32_t runs_len;
+	if (!analyze_runs_map(runes, fs, fs_color, vstr, index ? v_to_l : NULL,
+	                      runs, &runs_len)) {
+		free(runs);
+		return false;
+	}
+	gp_runes_t vrunes = {vstr, runes.len};
+	shape_runs(vrunes, lang, runs, runs_len);
+	if (index) {
+		build_cluster_index(runes, v_to_l, runs, runs_len, index);
+	}
 
 	*runs_out = runs;
 	*len = runs_len;
 	return true;
 }
 
-FcFontSet *gp_load_font(FcConfig *config, char *pattern, bool with_color)
+bool gp_analyze(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                const char *lang, gp_run_t **runs_out, uint32_t *len)
 {
+	return gp_analyze_index(runes, fs, fs_color, lang, runs_out, len, NULL);
+}
 
-	FcResult result; // maybe someone uses this sometimes or something.
-	FcPattern *pat = FcNameParse((FcChar8 *)pattern);
+// Graphemes in cluster c, ligatures of several letters have more than one.
+static uint32_t cluster_graphemes(const gp_cluster_index_t *index, uint32_t c)
+{
+	uint32_t n = 1;
+	for (uint32_t l = index->lstart[c] + 1; l < index->lend[c]; l++) {
+		n += index->graphemes[l];
+	}
+	return n;
+}
+
+uint32_t gp_cluster_hit(const gp_cluster_index_t *index, double x)
+{
+	if (index->len == 0) {
+		return 0;
+	}
+	// Last cluster whose left edge is at or before x.
+	uint32_t lo = 0, hi = index->len;
+	while (hi - lo > 1) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (index->x[mid] <= x) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+	double w = index->x[lo + 1] - index->x[lo];
+	double f = w > 0.0 ? (x - index->x[lo]) / w : 0.0;
+	f = f < 0.0 ? 0.0 : f > 1.0 ? 1.0 : f;
+	if (index->rtl[lo]) {
+		f = 1.0 - f;
+	}
+	// Ligatures split evenly between their graphemes, never inside one.
+	uint32_t n = cluster_graphemes(index, lo);
+	uint32_t g = (uint32_t)(f * n + 0.5);
+	if (g == n) {
+		return index->lend[lo];
+	}
+	uint32_t l = index->lstart[lo];
+	while (g) {
+		g -= index->graphemes[++l];
+	}
+	return l;
+}
+
+double gp_cluster_caret_x(const gp_cluster_index_t *index, uint32_t offset)
+{
+	if (index->len == 0 || index->runes_len == 0) {
+		return 0.0;
+	}
+	bool end = offset >= index->runes_len;
+	uint32_t c = index->l_to_c[end ? index->runes_len - 1 : offset];
+	// Graphemes of the cluster before offset, which counts as the start of
+	// the grapheme it is in.
+	uint32_t g = 0;
+	for (uint32_t l = index->lstart[c] + 1; l <= offset && l < index->lend[c];
+	     l++) {
+		g += index->graphemes[l];
+	}
+	double f = end || offset >= index->lend[c]
+	                   ? 1.0
+	                   : (double)g / cluster_graphemes(index, c);
+	if (index->rtl[c]) {
+		f = 1.0 - f;
+	}
+	return index->x[c] + f * (index->x[c + 1] - index->x[c]);
+}
+
+void gp_cluster_index_destroy(gp_cluster_index_t *index)
+{
+	free(index->x);
+	free(index->lstart);
+	free(index->lend);
+	free(index->rtl);
+	free(index->l_to_c);
+	free(index->graphemes);
+	memset(index, 0, sizeof(*index));
+}
+
+// Text analyzed once for truncating to any number of widths. Cut points are
+// logical offsets at grapheme and cluster boundaries, with the width of
+// everything before them, so a width is a binary search away.
+struct gp_truncator {
+	uint32_t *runes; // logical
+	uint32_t runes_len;
+	uint32_t *v_to_l;
+	gp_run_t *runs;
+	uint32_t runs_len;
+	gp_cluster_index_t index;
+
+	uint32_t *cuts;
+	double *cut_x;
+	uint32_t cuts_len;
+
+	gp_run_t *ellipsis;
+	uint32_t ellipsis_len;
+	double ellipsis_width;
+};
+
+// U+2026 or three periods when the fontset lacks it.
+static bool shape_ellipsis(gp_truncator_t *t, FcFontSet *fs,
+                           FcFontSet *fs_color, const char *lang)
+{
+	static const uint32_t ellipsis[][3] = {{0x2026}, {'.', '.', '.'}};
+	static const uint32_t lens[] = {1, 3};
+	for (uint32_t e = 0; e < 2; e++) {
+		uint32_t vstr[3];
+		gp_runes_t runes = {(uint32_t *)ellipsis[e], lens[e]};
+		t->ellipsis = malloc(sizeof(gp_run_t) * (lens[e] + 1));
+		if (!analyze_runs(runes, fs, fs_color, vstr, t->ellipsis,
+		                  &t->ellipsis_len)) {
+			free(t->ellipsis);
+			t->ellipsis = NULL;
+			return false;
+		}
+		gp_runes_t vrunes = {vstr, lens[e]};
+		shape_runs(vrunes, lang, t->ellipsis, t->ellipsis_len);
+		bool notdef = false;
+		t->ellipsis_width = 0.0;
+		for (uint32_t i = 0; i < t->ellipsis_len; i++) {
+			uint32_t glen;
+			hb_glyph_info_t *info =
+			        hb_buffer_get_glyph_infos(t->ellipsis[i].glyphs, &glen);
+			hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(
+			        t->ellipsis[i].glyphs, NULL);
+			for (uint32_t g = 0; g < glen; g++) {
+				notdef |= info[g].codepoint == 0;
+				t->ellipsis_width += pos[g].x_advance / (double)GP_SHAPE_SCALE;
+			}
+		}
+		if (!notdef || e == 1) {
+			return true;
+		}
+		gp_run_destroy(t->ellipsis, t->ellipsis_len);
+	}
+	return false;
+}
+
+gp_truncator_t *gp_truncator_create(gp_runes_t runes, FcFontSet *fs,
+                                    FcFontSet *fs_color, const char *lang)
+{
+	assert(runes.len < 4096); // I dont want to malloc.
+	gp_truncator_t *t = calloc(1, sizeof(gp_truncator_t));
+	t->runes = malloc(sizeof(uint32_t) * (runes.len + 1));
+	memcpy(t->runes, runes.data, sizeof(uint32_t) * runes.len);
+	t->runes_len = runes.len;
+
+	uint32_t vstr[4096];
+	t->v_to_l = malloc(sizeof(uint32_t) * (runes.len + 1));
+	t->runs = malloc(sizeof(gp_run_t) * (runes.len + 1));
+	if (!analyze_runs_map(runes, fs, fs_color, vstr, t->v_to_l, t->runs,
+	                      &t->runs_len)) {
+		t->runs_len = 0;
+		gp_truncator_destroy(t);
+		return NULL;
+	}
+	gp_runes_t vrunes = {vstr, runes.len};
+	shape_runs(vrunes, lang, t->runs, t->runs_len);
+	build_cluster_index(runes, t->v_to_l, t->runs, t->runs_len, &t->index);
+	if (!shape_ellipsis(t, fs, fs_color, lang)) {
+		gp_truncator_destroy(t);
+		return NULL;
+	}
+
+	// Never cut inside a grapheme or ligature, nor right after a space
+	// which would leave a gap before the ellipsis.
+	gp_props_t props[4096];
+	gp_classify(runes, props);
+	const gp_cluster_index_t *idx = &t->index;
+	const bool *breaks = idx->graphemes;
+	t->cuts = malloc(sizeof(uint32_t) * (runes.len + 1));
+	t->cut_x = malloc(sizeof(double) * (runes.len + 1));
+	double x = 0.0;
+	for (uint32_t k = 0; k < runes.len; k++) {
+		bool cut = k == 0 || (breaks[k] && !(props[k - 1] & GP_PROPS_SPACE) &&
+		                      idx->l_to_c[k - 1] != idx->l_to_c[k]);
+		if (cut) {
+			t->cuts[t->cuts_len] = k;
+			t->cut_x[t->cuts_len] = x;
+			t->cuts_len++;
+		}
+		uint32_t c = idx->l_to_c[k];
+		if (idx->len && idx->lstart[c] == k) {
+			x += idx->x[c + 1] - idx->x[c];
+		}
+	}
+	return t;
+}
+
+void gp_truncator_destroy(gp_truncator_t *t)
+{
+	gp_run_destroy(t->runs, t->runs_len);
+	if (t->ellipsis) {
+		gp_run_destroy(t->ellipsis, t->ellipsis_len);
+	}
+	if (t->index.x) {
+		gp_cluster_index_destroy(&t->index);
+	}
+	free(t->runes);
+	free(t->v_to_l);
+	free(t->cuts);
+	free(t->cut_x);
+	free(t);
+}
+
+// Index into cuts of the longest prefix that fits with the ellipsis, 0
+// (just the ellipsis) if none do.
+static uint32_t truncate_search(const gp_truncator_t *t, double max_width)
+{
+	uint32_t lo = 0, hi = t->cuts_len;
+	while (hi - lo > 1) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (t->cut_x[mid] + t->ellipsis_width <= max_width) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+uint32_t gp_truncate_fit(const gp_truncator_t *t, double max_width,
+                         double *width)
+{
+	// Empty text has no cuts to search.
+	if (max_width < 0.0) {
+		max_width = 0.0;
+	}
+	double total = t->index.len ? t->index.x[t->index.len] : 0.0;
+	if (total <= max_width) {
+		*width = total;
+		return t->runes_len;
+	}
+	uint32_t j = truncate_search(t, max_width);
+	*width = t->cut_x[j] + t->ellipsis_width;
+	return t->cuts[j];
+}
+
+// Reshape the last kept cluster, the glyph it joined to is gone. Only the
+// cluster itself is shaped, the kept part of its run is context.
+static hb_buffer_t *shape_boundary(const gp_truncator_t *t, const gp_run_t *run,
+                                   uint32_t lfirst, uint32_t c, uint32_t keep)
+{
+	const gp_cluster_index_t *idx = &t->index;
+	hb_buffer_t *buf = hb_buffer_create();
+	hb_buffer_add_codepoints(buf, &t->runes[lfirst], keep - lfirst,
+	                         idx->lstart[c] - lfirst,
+	                         idx->lend[c] - idx->lstart[c]);
+	hb_segment_properties_t props;
+	hb_buffer_get_segment_properties(run->glyphs, &props);
+	hb_buffer_set_segment_properties(buf, &props);
+	// Not through the shape cache, it doesnt key on context.
+	gp_shaper shaper;
+	shaper_load(&shaper, run->font);
+	hb_shape(shaper.font, buf, NULL, 0);
+	shaper_release(&shaper);
+	return buf;
+}
+
+// The runs of the first keep logical runes, in their original visual order,
+// then the ellipsis if anything was cut.
+static void truncate_runs(const gp_truncator_t *t, uint32_t keep,
+                          gp_run_t **runs_out, uint32_t *len)
+{
+	const gp_cluster_index_t *idx = &t->index;
+	gp_run_t *runs =
+	        malloc(sizeof(gp_run_t) * (t->runs_len + t->ellipsis_len + 1));
+	uint32_t n = 0;
+	// The cluster ending the kept text, only its run is cut short.
+	uint32_t boundary = keep && keep < t->runes_len ? idx->l_to_c[keep - 1]
+	                                                : UINT32_MAX;
+	for (uint32_t i = 0; i < t->runs_len; i++) {
+		const gp_run_t *run = &t->runs[i];
+		uint32_t lfirst = UINT32_MAX, llast = 0;
+		for (uint32_t v = run->start; v < run->end; v++) {
+			uint32_t l = t->v_to_l[v];
+			lfirst = l < lfirst ? l : lfirst;
+			llast = l > llast ? l : llast;
+		}
+		if (lfirst >= keep) {
+			continue;
+		}
+		hb_buffer_t *edge = NULL;
+		uint32_t elen = 0;
+		if (llast >= keep && boundary != UINT32_MAX) {
+			edge = shape_boundary(t, run, lfirst, boundary, keep);
+			elen = hb_buffer_get_length(edge);
+		}
+
+		uint32_t glen;
+		hb_glyph_info_t *info = hb_buffer_get_glyph_infos(run->glyphs, &glen);
+		hb_glyph_position_t *pos =
+		        hb_buffer_get_glyph_positions(run->glyphs, NULL);
+		hb_glyph_info_t *kinfo =
+		        malloc(sizeof(hb_glyph_info_t) * (glen + elen + 1));
+		hb_glyph_position_t *kpos =
+		        malloc(sizeof(hb_glyph_position_t) * (glen + elen + 1));
+		uint32_t kept = 0, vmin = run->end, vmax = run->start;
+		bool spliced = false;
+		for (uint32_t g = 0; g < glen; g++) {
+			uint32_t v = run->start + info[g].cluster;
+			uint32_t l = t->v_to_l[v];
+			if (l >= keep) {
+				continue;
+			}
+			vmin = v < vmin ? v : vmin;
+			vmax = v + 1 > vmax ? v + 1 : vmax;
+			if (!edge || idx->l_to_c[l] != boundary) {
+				kinfo[kept] = info[g];
+				kpos[kept++] = pos[g];
+				continue;
+			}
+			if (spliced) {
+				continue;
+			}
+			// Keep the visual cluster numbering of the run.
+			hb_glyph_info_t *einfo = hb_buffer_get_glyph_infos(edge, NULL);
+			hb_glyph_position_t *epos =
+			        hb_buffer_get_glyph_positions(edge, NULL);
+			for (uint32_t e = 0; e < elen; e++) {
+				kinfo[kept] = einfo[e];
+				kinfo[kept].cluster = info[g].cluster;
+				kpos[kept++] = epos[e];
+			}
+			spliced = true;
+		}
+		runs[n] = *run;
+		runs[n].start = vmin;
+		runs[n].end = vmax;
+		runs[n].glyphs = hb_buffer_create();
+		hb_segment_properties_t props;
+		hb_buffer_get_segment_properties(run->glyphs, &props);
+		set_glyphs(runs[n].glyphs, &props, kinfo, kpos, kept);
+		n++;
+		free(kinfo);
+		free(kpos);
+		hb_buffer_destroy(edge);
+	}
+
+	// Base direction is always LTR, the ellipsis goes on the right.
+	for (uint32_t i = 0; keep < t->runes_len && i < t->ellipsis_len; i++) {
+		uint32_t glen;
+		hb_buffer_t *glyphs = t->ellipsis[i].glyphs;
+		hb_glyph_info_t *info = hb_buffer_get_glyph_infos(glyphs, &glen);
+		hb_glyph_position_t *pos =
+		        hb_buffer_get_glyph_positions(glyphs, NULL);
+		hb_segment_properties_t props;
+		hb_buffer_get_segment_properties(glyphs, &props);
+		runs[n] = t->ellipsis[i];
+		runs[n].start = runs[n].end = t->runes_len;
+		runs[n].glyphs = hb_buffer_create();
+		set_glyphs(runs[n].glyphs, &props, info, pos, glen);
+		n++;
+	}
+	*runs_out = runs;
+	*len = n;
+}
+
+void gp_truncate(const gp_truncator_t *t, double max_width,
+                 gp_run_t **runs_out, uint32_t *len)
+{
+	if (max_width < 0.0) {
+		max_width = 0.0;
+	}
+	double total = t->index.len ? t->index.x[t->index.len] : 0.0;
+	if (total <= max_width) {
+		truncate_runs(t, t->runes_len, runs_out, len);
+		return;
+	}
+	// A reshaped boundary cluster can come out wider, then back off.
+	for (uint32_t j = truncate_search(t, max_width);; j--) {
+		truncate_runs(t, t->cuts[j], runs_out, len);
+		double width = 0.0;
+		for (uint32_t i = 0; i < *len; i++) {
+			uint32_t glen;
+			hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(
+			        (*runs_out)[i].glyphs, &glen);
+			for (uint32_t g = 0; g < glen; g++) {
+				width += pos[g].x_advance / (double)GP_SHAPE_SCALE;
+			}
+		}
+		if (j == 0 || width <= max_width) {
+			return;
+		}
+		gp_run_destroy(*runs_out, *len);
+	}
+}
+
+typedef struct batch_item {
+	uint32_t font;
+	uint32_t run;
+	uint32_t base; // offset of the run's string in the visual runes
+} batch_item;
+
+int batch_item_cmp(const void *l, const void *r)
+{
+	const batch_item *li = l, *ri = r;
+	if (li->font != ri->font) {
+		return li->font < ri->font ? -1 : 1;
+	}
+	return li->run < ri->run ? -1 : li->run > ri->run;
+}
+
+bool gp_analyze_batch(const gp_runes_t *strings, uint32_t len, FcFontSet *fs,
+                      FcFontSet *fs_color, const char *lang, gp_batch_t *out)
+{
+	hb_language_t language = language_for(lang);
+	uint32_t total = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		total += strings[i].len;
+	}
+	uint32_t *vstr = malloc(sizeof(uint32_t) * (total + 1));
+	uint32_t *offsets = malloc(sizeof(uint32_t) * (len + 1));
+	gp_run_t *runs = NULL;
+	uint32_t runs_len = 0, runs_cap = 0;
+
+	uint32_t base = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		offsets[i] = runs_len;
+		if (strings[i].len == 0) {
+			continue;
+		}
+		if (runs_len + strings[i].len + 1 > runs_cap) {
+			runs_cap = runs_cap * 2 + strings[i].len + 1;
+			runs = realloc(runs, sizeof(gp_run_t) * runs_cap);
+		}
+		uint32_t n;
+		if (!analyze_runs(strings[i], fs, fs_color, &vstr[base],
+		                  &runs[runs_len], &n)) {
+			free(vstr);
+			free(offsets);
+			free(runs);
+			return false;
+		}
+		runs_len += n;
+		base += strings[i].len;
+	}
+	offsets[len] = runs_len;
+
+	// Shape every run of a font back to back so each font is loaded once
+	// and its tables stay hot.
+	batch_item *items = malloc(sizeof(batch_item) * (runs_len + 1));
+	base = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		for (uint32_t r = offsets[i]; r < offsets[i + 1]; r++) {
+			items[r] = (batch_item){runs[r].font, r, base};
+		}
+		base += strings[i].len;
+	}
+	qsort(items, runs_len, sizeof(batch_item), batch_item_cmp);
+
+	uint32_t font = 0;
+	gp_shaper shaper = {0};
+	for (uint32_t k = 0; k < runs_len; k++) {
+		if (items[k].font != font) {
+			shaper_release(&shaper);
+			font = items[k].font;
+			shaper_load(&shaper, font);
+		}
+		shape_run(&shaper, language, &vstr[items[k].base],
+		          &runs[items[k].run]);
+	}
+	shaper_release(&shaper);
+	free(items);
+	free(vstr);
+
+	out->runs = runs;
+	out->runs_len = runs_len;
+	out->offsets = offsets;
+	out->len = len;
+	return true;
+}
+
+void gp_batch_destroy(gp_batch_t *batch)
+{
+	gp_run_destroy(batch->runs, batch->runs_len);
+	free(batch->offsets);
+	batch->runs = NULL;
+	batch->offsets = NULL;
+	batch->runs_len = batch->len = 0;
+}
+
+// Parsed and substituted pattern, ready to sort by.
+FcPattern *font_pattern(FcConfig *config, const char *pattern, bool with_color)
+{
+	FcPattern *pat = FcNameParse((const FcChar8 *)pattern);
 	if (!pat) {
 		printf("Woops failed to parse pattern: %s\n", pattern);
 		return NULL;
@@ -285,6 +1359,17 @@ FcFontSet *gp_load_font(FcConfig *config, char *pattern, bool with_color)
 	}
 	FcConfigSubstitute(config, pat, FcMatchPattern);
 	FcDefaultSubstitute(pat);
+	return pat;
+}
+
+FcFontSet *gp_load_font(FcConfig *config, char *pattern, bool with_color)
+{
+
+	FcResult result; // maybe someone uses this sometimes or something.
+	FcPattern *pat = font_pattern(config, pattern, with_color);
+	if (!pat) {
+		return NULL;
+	}
 
 	// https://www.freedesktop.org/software/fontconfig/fontconfig-devel/fcfontsort.html
 	// Do the pattern search based on search. Optionally return coverage.
@@ -310,62 +1395,455 @@ FcFontSet *gp_load_font(FcConfig *config, char *pattern, bool with_color)
 	return fs;
 }
 
+// Sorted fonts of a pattern, sorted once and untrimmed, with the fontsets
+// derived from it per language.
+typedef struct font_lang {
+	struct font_lang *next;
+	hb_language_t language; // NULL for the plain sort
+	FcFontSet *fs;
+} font_lang;
+
+typedef struct font_sort {
+	struct font_sort *next;
+	FcConfig *config;
+	char *pattern;
+	bool with_color;
+	FcPattern *families; // as parsed, the families asked for by name
+	FcPattern *pat; // substituted
+	FcFontSet *sorted;
+	font_lang *langs;
+} font_sort;
+
+static font_sort *font_sorts;
+static pthread_mutex_t font_sorts_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Same language, or one of them has no territory ("ja", "ja-jp"). Unlike
+// FcLangCompare zh-cn and zh-tw dont match.
+static bool lang_matches(const char *l, const char *r)
+{
+	size_t ll = strlen(l), rl = strlen(r);
+	size_t n = ll < rl ? ll : rl;
+	return strncasecmp(l, r, n) == 0 &&
+	       (l[n] == r[n] || l[n] == '-' || r[n] == '-');
+}
+
+// Where font goes for lang, lower first: families the pattern names (they
+// win over lang in FcFontSort too), fonts named for the language (CJK fonts
+// per region only differ here, their coverage is the same), covering it,
+// covering it elsewhere, the rest.
+static int font_lang_rank(FcPattern *font, FcPattern *families,
+                          const char *lang)
+{
+	FcChar8 *s, *family;
+	for (int i = 0;
+	     FcPatternGetString(font, FC_FAMILY, i, &s) == FcResultMatch; i++) {
+		for (int j = 0; FcPatternGetString(families, FC_FAMILY, j,
+		                                   &family) == FcResultMatch;
+		     j++) {
+			if (FcStrCmpIgnoreCase(s, family) == 0) {
+				return 0;
+			}
+		}
+	}
+	for (int i = 0;
+	     FcPatternGetString(font, FC_FAMILYLANG, i, &s) == FcResultMatch;
+	     i++) {
+		if (lang_matches((const char *)s, lang)) {
+			return 1;
+		}
+	}
+	FcLangSet *ls;
+	if (FcPatternGetLangSet(font, FC_LANG, 0, &ls) == FcResultMatch) {
+		switch (FcLangSetHasLang(ls, (const FcChar8 *)lang)) {
+		case FcLangEqual:
+			return 2;
+		case FcLangDifferentTerritory:
+			return 3;
+		default:
+			break;
+		}
+	}
+	return 4;
+}
+
+// Render ready fonts of a sort, those for language moved up. Fonts adding
+// no coverage are dropped like FcFontSort's trim, after reordering so a
+// language keeps its own fonts.
+static FcFontSet *font_sort_derive(font_sort *fsort, hb_language_t language)
+{
+	FcFontSet *sorted = fsort->sorted;
+	FcPattern **order = malloc(sizeof(FcPattern *) * (sorted->nfont + 1));
+	if (language) {
+		// Stable counting sort by rank.
+		const char *lang = hb_language_to_string(language);
+		uint8_t *ranks = malloc(sorted->nfont + 1);
+		uint32_t counts[6] = {0};
+		for (int i = 0; i < sorted->nfont; i++) {
+			ranks[i] = font_lang_rank(sorted->fonts[i], fsort->families,
+			                          lang);
+			counts[ranks[i] + 1]++;
+		}
+		for (uint32_t r = 1; r < 6; r++) {
+			counts[r] += counts[r - 1];
+		}
+		for (int i = 0; i < sorted->nfont; i++) {
+			order[counts[ranks[i]]++] = sorted->fonts[i];
+		}
+		free(ranks);
+	} else {
+		memcpy(order, sorted->fonts, sizeof(FcPattern *) * sorted->nfont);
+	}
+
+	FcFontSet *fs = FcFontSetCreate();
+	FcCharSet *covered = FcCharSetCreate();
+	for (int i = 0; i < sorted->nfont; i++) {
+		FcCharSet *cs;
+		if (FcPatternGetCharSet(order[i], FC_CHARSET, 0, &cs) !=
+		            FcResultMatch ||
+		    FcCharSetIsSubset(cs, covered)) {
+			continue;
+		}
+		FcCharSetMerge(covered, cs, NULL);
+		FcPattern *font_pattern =
+		        FcFontRenderPrepare(fsort->config, fsort->pat, order[i]);
+		if (font_pattern)
+			FcFontSetAdd(fs, font_pattern);
+	}
+	FcCharSetDestroy(covered);
+	free(order);
+	return fs;
+}
+
+// Sort the pattern, again if gp_trim dropped the sort.
+static bool font_sort_load(font_sort *f)
+{
+	if (f->sorted) {
+		return true;
+	}
+	FcPattern *pat = font_pattern(f->config, f->pattern, f->with_color);
+	if (!pat) {
+		return false;
+	}
+	FcResult result;
+	FcFontSet *sorted = FcFontSort(f->config, pat, FcFalse, NULL, &result);
+	if (!sorted || sorted->nfont == 0) {
+		printf("Woops no fonts installed?\n");
+		if (sorted)
+			FcFontSetSortDestroy(sorted);
+		FcPatternDestroy(pat);
+		return false;
+	}
+	f->pat = pat;
+	f->sorted = sorted;
+	return true;
+}
+
+static void font_sort_drop(font_sort *f)
+{
+	if (f->sorted) {
+		FcFontSetSortDestroy(f->sorted);
+		FcPatternDestroy(f->pat);
+	}
+	f->sorted = NULL;
+	f->pat = NULL;
+}
+
+static font_sort *font_sort_for(FcConfig *config, const char *pattern,
+                                bool with_color)
+{
+	for (font_sort *f = font_sorts; f; f = f->next) {
+		if (f->config == config && f->with_color == with_color &&
+		    strcmp(f->pattern, pattern) == 0) {
+			return f;
+		}
+	}
+	font_sort *f = calloc(1, sizeof(font_sort));
+	*f = (font_sort){
+	        .config = config,
+	        .pattern = strdup(pattern),
+	        .with_color = with_color,
+	        .families = FcNameParse((const FcChar8 *)pattern),
+	};
+	if (!font_sort_load(f)) {
+		if (f->families)
+			FcPatternDestroy(f->families);
+		free(f->pattern);
+		free(f);
+		return NULL;
+	}
+	f->next = font_sorts;
+	font_sorts = f;
+	return f;
+}
+
+FcFontSet *gp_font_for_lang(FcConfig *config, const char *pattern,
+                            const char *lang, bool with_color)
+{
+	hb_language_t language = lang ? language_for(lang) : NULL;
+	pthread_mutex_lock(&font_sorts_lock);
+	FcFontSet *fs = NULL;
+	font_sort *fsort = font_sort_for(config, pattern, with_color);
+	if (fsort) {
+		font_lang *fl = fsort->langs;
+		while (fl && fl->language != language) {
+			fl = fl->next;
+		}
+		if (!fl && font_sort_load(fsort)) {
+			fl = malloc(sizeof(font_lang));
+			*fl = (font_lang){fsort->langs, language,
+			                  font_sort_derive(fsort, language)};
+			fsort->langs = fl;
+		}
+		fs = fl ? fl->fs : NULL;
+	}
+	pthread_mutex_unlock(&font_sorts_lock);
+	return fs;
+}
+
+void gp_font_cache_clear(void)
+{
+	pthread_mutex_lock(&font_sorts_lock);
+	for (font_sort *f = font_sorts, *next; f; f = next) {
+		next = f->next;
+		for (font_lang *fl = f->langs, *lnext; fl; fl = lnext) {
+			lnext = fl->next;
+			FcFontSetDestroy(fl->fs);
+			free(fl);
+		}
+		font_sort_drop(f);
+		if (f->families)
+			FcPatternDestroy(f->families);
+		free(f->pattern);
+		free(f);
+	}
+	font_sorts = NULL;
+	pthread_mutex_unlock(&font_sorts_lock);
+}
+
 void gp_utf8_to_runes(const char *utf8, uint32_t len, uint32_t dst_cap,
                       uint32_t *dst, uint32_t *dst_len)
 {
-	UNUSED(dst_cap);
 	int char_set_num = fribidi_parse_charset("UTF-8");
-	*dst_len = fribidi_charset_to_unicode(char_set_num, utf8, len, dst);
+	if (len <= dst_cap) {
+		// never more runes than bytes.
+		*dst_len = fribidi_charset_to_unicode(char_set_num, utf8, len, dst);
+		return;
+	}
+	uint32_t *tmp = malloc(sizeof(uint32_t) * len);
+	uint32_t n = fribidi_charset_to_unicode(char_set_num, utf8, len, tmp);
+	*dst_len = n < dst_cap ? n : dst_cap;
+	memcpy(dst, tmp, sizeof(uint32_t) * *dst_len);
+	free(tmp);
 }
 
-void gp_draw_cairo(cairo_t *cr, gp_run_t *runs, uint32_t len)
+void gp_measure(gp_run_t *runs, uint32_t len, double *width, double *ascent,
+                double *descent)
 {
+	*width = *ascent = *descent = 0.0;
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t glen;
+		hb_glyph_position_t *pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
+		for (uint32_t k = 0; k < glen; k++) {
+			*width += pos[k].x_advance / (double)GP_SHAPE_SCALE;
+		}
+		if (!runs[i].font || (i > 0 && runs[i].font == runs[i - 1].font)) {
+			continue;
+		}
+		cairo_font_extents_t ext;
+		cairo_scaled_font_t *font = scaled_font_for(runs[i].font, NULL);
+		cairo_scaled_font_extents(font, &ext);
+		cairo_scaled_font_destroy(font);
+		*ascent = ext.ascent > *ascent ? ext.ascent : *ascent;
+		*descent = ext.descent > *descent ? ext.descent : *descent;
+	}
+}
+
+void gp_draw_cairo(cairo_t *cr, gp_run_t *runs, uint32_t len, double x,
+                   double y)
+{
+	uint32_t total = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		total += hb_buffer_get_length(runs[i].glyphs);
+	}
+	cairo_glyph_t *draw_glyph = malloc(sizeof(cairo_glyph_t) * (total + 1));
+	// Scaled fonts dont pick up the target's options like faces set on cr.
+	cairo_font_options_t *options = font_options_for(cr);
+
 	uint32_t i = 0;
-	double x = 0.0, y = 48.0;
 	while (i < len) {
-		cairo_font_face_t *face =
-		        cairo_ft_font_face_create_for_pattern(runs[i].font);
-		cairo_set_font_face(cr, face);
-		double size;
-		FcPatternGetDouble(runs[i].font, FC_PIXEL_SIZE, 0, &size);
-		cairo_matrix_t font_mat = {size, 0, 0, size, 0, 0};
-
-		// typically provided by 10-scale-bitmap-fonts.conf, maybe
-		// other fonts will have matrix factors as well. Only use this
-		// if the font is marked "scalable".
-		FcMatrix *scale_mat;
-		FcBool scalable;
-		if (FcPatternGetMatrix(runs[i].font, FC_MATRIX, 0, &scale_mat) ==
-		            FcResultMatch &&
-		    (FcPatternGetBool(runs[i].font, "scalable", 0, &scalable) ==
-		             FcResultMatch &&
-		     scalable)) {
-			if (scale_mat->xy != 0.0 || scale_mat->yx != 0.0) {
-				printf("Uh-oh, shear/rotate matrix detected. Rendering probably going wrong.\n");
+		// Runs split on script or level often keep the font, submit all
+		// glyphs of adjacent runs with the same font at once.
+		uint32_t font_id = runs[i].font;
+		uint32_t g = 0;
+		for (; i < len && runs[i].font == font_id; i++) {
+			uint32_t glen;
+			hb_glyph_position_t *glyph_pos =
+			        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
+			hb_glyph_info_t *glyph_info =
+			        hb_buffer_get_glyph_infos(runs[i].glyphs, NULL);
+			for (uint32_t k = 0; k < glen; k++, g++) {
+				draw_glyph[g].index = glyph_info[k].codepoint;
+				draw_glyph[g].x =
+				        x + glyph_pos[k].x_offset / (float)GP_SHAPE_SCALE;
+				draw_glyph[g].y =
+				        y + glyph_pos[k].y_offset / (float)GP_SHAPE_SCALE;
+				x += glyph_pos[k].x_advance / (float)GP_SHAPE_SCALE;
+				y += glyph_pos[k].y_advance / (float)GP_SHAPE_SCALE;
 			}
-			font_mat.xx *= scale_mat->xx;
-			font_mat.yy *= scale_mat->yy;
 		}
-		cairo_set_font_matrix(
-		        cr,
-		        &font_mat); // must match shaping size, no scaling factor since cairo isnt integer based.
+		cairo_scaled_font_t *font = scaled_font_for(font_id, options);
+		if (font) {
+			cairo_set_scaled_font(cr, font);
+			cairo_scaled_font_destroy(font);
+			cairo_show_glyphs(cr, draw_glyph, g);
+		}
+	}
+	cairo_font_options_destroy(options);
+	free(draw_glyph);
+}
 
-		uint32_t glen;
-		hb_glyph_position_t *glyph_pos =
-		        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
-		hb_glyph_info_t *glyph_info =
-		        hb_buffer_get_glyph_infos(runs[i].glyphs, NULL);
-		cairo_glyph_t *draw_glyph = malloc(sizeof(cairo_glyph_t) * glen);
-		uint32_t g = 0;
-		while (g < glen) {
-			draw_glyph[g].index = glyph_info[g].codepoint;
-			draw_glyph[g].x = x + glyph_pos[g].x_offset / (float)GP_SHAPE_SCALE;
-			draw_glyph[g].y = y + glyph_pos[g].y_offset / (float)GP_SHAPE_SCALE;
-			x += glyph_pos[g].x_advance / (float)GP_SHAPE_SCALE;
-			y += glyph_pos[g].y_advance / (float)GP_SHAPE_SCALE;
-			g++;
+// Patterns are opaque, guess from the number of objects.
+#define GP_PATTERN_OBJECT_BYTES 48
+
+static int ptr_cmp(const void *l, const void *r)
+{
+	uintptr_t a = *(const uintptr_t *)l, b = *(const uintptr_t *)r;
+	return a < b ? -1 : a > b;
+}
+
+static size_t charset_bytes(const FcCharSet *cs)
+{
+	FcChar32 map[FC_CHARSET_MAP_SIZE], next;
+	size_t pages = 0;
+	for (FcChar32 page = FcCharSetFirstPage(cs, map, &next);
+	     page != FC_CHARSET_DONE; page = FcCharSetNextPage(cs, map, &next)) {
+		pages++;
+	}
+	// A leaf, its number and its offset per page.
+	return pages * (sizeof(map) + sizeof(uint16_t) + sizeof(intptr_t));
+}
+
+static void font_sorts_memory(gp_memory_stats_t *stats)
+{
+	// Fontsets of different languages share fonts, count charsets once.
+	const FcCharSet **charsets = NULL;
+	size_t charsets_len = 0, charsets_cap = 0;
+	for (font_sort *f = font_sorts; f; f = f->next) {
+		stats->fontsets += sizeof(font_sort) + strlen(f->pattern) + 1;
+		if (f->sorted) {
+			stats->fontsets +=
+			        sizeof(FcFontSet) +
+			        sizeof(FcPattern *) * f->sorted->sfont +
+			        GP_PATTERN_OBJECT_BYTES * FcPatternObjectCount(f->pat);
+		}
+		for (font_lang *fl = f->langs; fl; fl = fl->next) {
+			FcFontSet *fs = fl->fs;
+			stats->fontsets += sizeof(font_lang) + sizeof(FcFontSet) +
+			                   sizeof(FcPattern *) * fs->sfont;
+			if (charsets_len + fs->nfont > charsets_cap) {
+				charsets_cap = (charsets_len + fs->nfont) * 2;
+				charsets = realloc(charsets,
+				                   sizeof(FcCharSet *) * charsets_cap);
+			}
+			for (int i = 0; i < fs->nfont; i++) {
+				stats->fontsets += GP_PATTERN_OBJECT_BYTES *
+				                   FcPatternObjectCount(fs->fonts[i]);
+				FcCharSet *cs;
+				if (FcPatternGetCharSet(fs->fonts[i], FC_CHARSET, 0, &cs) ==
+				    FcResultMatch) {
+					charsets[charsets_len++] = cs;
+				}
+			}
+		}
+	}
+	qsort(charsets, charsets_len, sizeof(FcCharSet *), ptr_cmp);
+	for (size_t i = 0; i < charsets_len; i++) {
+		if (i == 0 || charsets[i] != charsets[i - 1]) {
+			stats->charsets += charset_bytes(charsets[i]);
+		}
+	}
+	free(charsets);
+}
+
+void gp_memory_stats(gp_memory_stats_t *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+
+	pthread_mutex_lock(&font_sorts_lock);
+	font_sorts_memory(stats);
+	pthread_mutex_unlock(&font_sorts_lock);
+
+	pthread_mutex_lock(&blobs_lock);
+	for (uint32_t i = 0; i < GP_BLOB_CACHE; i++) {
+		if (blobs[i].blob) {
+			stats->blobs += hb_blob_get_length(blobs[i].blob);
+		}
+	}
+	pthread_mutex_unlock(&blobs_lock);
+
+	pthread_once(&shape_cache_once, shape_cache_init);
+	for (uint32_t i = 0; i < GP_SHAPE_CACHE; i++) {
+		pthread_mutex_t *lock = &shape_cache_locks[i % GP_SHAPE_LOCKS];
+		pthread_mutex_lock(lock);
+		shape_entry *e = &shape_cache[i];
+		if (e->infos) {
+			stats->shaped += strlen(e->file) + 1 +
+			                 sizeof(uint32_t) * e->text_len +
+			                 (sizeof(hb_glyph_info_t) +
+			                  sizeof(hb_glyph_position_t)) *
+			                         e->len;
+		}
+		pthread_mutex_unlock(lock);
+	}
+
+	fonts_memory(stats);
+	raster_memory(stats);
+}
+
+static size_t memory_total(const gp_memory_stats_t *stats)
+{
+	return stats->fontsets + stats->charsets + stats->blobs + stats->shaped +
+	       stats->glyphs + stats->tables;
+}
+
+size_t gp_trim(enum gp_trim_level level)
+{
+	gp_memory_stats_t before, after;
+	gp_memory_stats(&before);
+
+	pthread_once(&shape_cache_once, shape_cache_init);
+	for (uint32_t i = 0; i < GP_SHAPE_CACHE; i++) {
+		pthread_mutex_t *lock = &shape_cache_locks[i % GP_SHAPE_LOCKS];
+		pthread_mutex_lock(lock);
+		shape_entry_clear(&shape_cache[i]);
+		pthread_mutex_unlock(lock);
+	}
+	raster_trim(level);
+
+	if (level >= GP_TRIM_MEDIUM) {
+		fonts_trim();
+
+		pthread_mutex_lock(&blobs_lock);
+		for (uint32_t i = 0; i < GP_BLOB_CACHE; i++) {
+			free(blobs[i].file);
+			hb_blob_destroy(blobs[i].blob);
+			blobs[i].file = NULL;
+			blobs[i].blob = NULL;
 		}
-		cairo_show_glyphs(cr, draw_glyph, glen);
-		i++;
+		pthread_mutex_unlock(&blobs_lock);
 	}
+
+	if (level >= GP_TRIM_CRITICAL) {
+		// Derived fontsets are handed out, only the sorts can go.
+		pthread_mutex_lock(&font_sorts_lock);
+		for (font_sort *f = font_sorts; f; f = f->next) {
+			font_sort_drop(f);
+		}
+		pthread_mutex_unlock(&font_sorts_lock);
+	}
+
+	gp_memory_stats(&after);
+	size_t b = memory_total(&before), a = memory_total(&after);
+	return b > a ? b - a : 0;
 }
@@ -2,6 +2,7 @@
 #define GP_HEADER_GP_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <fontconfig/fontconfig.h>
 #include <cairo/cairo.h>
@@ -13,11 +14,6 @@
 // When drawing divide by this scale for pixel coordinates.
 #define GP_SHAPE_SCALE 2048
 
-typedef struct gp_runes {
-	uint32_t *data;
-	uint32_t len;
-} gp_runes_t;
-
 typedef struct gp_run {
 	uint32_t start;
 	uint32_t end;
@@ -26,32 +22,475 @@ typedef struct gp_run {
 	int32_t font_pri;
 	enum gp_script script;
 	enum gp_width width;
-	FcPattern *font;
+	uint32_t font; // interned, see gp_font_get. 0 if nothing covered it.
 	hb_buffer_t *glyphs;
 } gp_run_t;
 
-// Helper to convert utf8 to codepoints
+// Fonts of runs are interned by content into a small id that stays valid for
+// the life of the process, comparing ids compares fonts.
+typedef struct gp_font {
+	FcPattern *pattern; // referenced, the first one interned for the font
+	const char *file;
+	int index;
+	double size; // FC_PIXEL_SIZE
+	double scale_x, scale_y; // FC_MATRIX diagonal, 1 without one
+	bool scalable;
+	bool linear; // advances scale linearly with size
+} gp_font_t;
+
+// Id of pattern, the same for every pattern of the same file, index, pixel
+// size, matrix and rendering properties (FC_EMBOLDEN, FC_ANTIALIAS, hinting,
+// FC_RGBA, FC_LCD_FILTER and FC_FONT_VARIATIONS). 0 for NULL, or when there
+// are too many fonts (over 262143).
+uint32_t gp_font_intern(FcPattern *pattern);
+
+// The font of an id, NULL for 0.
+const gp_font_t *gp_font_get(uint32_t id);
+
+// Helper to convert utf8 to codepoints, truncating at dst_cap runes
 void gp_utf8_to_runes(const char *utf8, uint32_t len, uint32_t dst_cap,
                       uint32_t *dst, uint32_t *dst_len);
 
 // Helper to draw onto a cairo surface if you dont want to implement rendering yourself.
-void gp_draw_cairo(cairo_t *cr, gp_run_t *runs, uint32_t len);
+// x and y are the pen origin on the baseline.
+void gp_draw_cairo(cairo_t *cr, gp_run_t *runs, uint32_t len, double x,
+                   double y);
+
+// Measure runs as gp_draw_cairo lays them out: total advance and the largest
+// ascent and descent of the fonts used, all in pixels.
+void gp_measure(gp_run_t *runs, uint32_t len, double *width, double *ascent,
+                double *descent);
+
+// Retained drawing for text that changes little between frames. A frame is
+// the runs added since the last gp_retained_draw, it is diffed against the
+// frame before by run and then by glyph, and only the damaged area is
+// cleared and redrawn. A static frame costs a hash per run.
+typedef struct gp_retained gp_retained_t;
+
+typedef struct gp_rect {
+	int32_t x, y;
+	int32_t width, height;
+} gp_rect_t;
+
+// background is premultiplied 0xAARRGGBB, damaged areas are reset to it.
+gp_retained_t *gp_retained_create(uint32_t background);
+
+void gp_retained_destroy(gp_retained_t *r);
+
+// Add runs to the next frame, pen origin at x, y on the baseline. color is
+// premultiplied 0xAARRGGBB. runs may be freed right after.
+void gp_retained_add(gp_retained_t *r, gp_run_t *runs, uint32_t len, double x,
+                     double y, uint32_t color);
+
+// Draw the frame onto cr, which must hold the previous frame (the same
+// surface, untransformed). Writes at most cap damage rectangles in surface
+// pixels and returns how many, nearby damage is merged to fit. 0 means
+// nothing changed, or cap is 0 and damage isn't reported (it's still drawn).
+uint32_t gp_retained_draw(gp_retained_t *r, cairo_t *cr, gp_rect_t *damage,
+                          uint32_t cap);
+
+// Redraw everything drawn before and everything in the next frame, e.g.
+// after the surface was lost. Clear the surface to the background first.
+void gp_retained_invalidate(gp_retained_t *r);
+
+enum gp_image_format {
+	GP_IMAGE_A8,
+	GP_IMAGE_ARGB32, // premultiplied, native endian like CAIRO_FORMAT_ARGB32
+};
+
+// Caller owned pixel buffer for gp_draw_image.
+typedef struct gp_image {
+	uint8_t *data;
+	uint32_t width;
+	uint32_t height;
+	uint32_t stride; // bytes per row
+	enum gp_image_format format;
+} gp_image_t;
+
+// Rasterize runs straight into img with FreeType, without cairo. Glyph
+// bitmaps are cached per font at subpixel offsets so drawing cached glyphs
+// allocates nothing. color is premultiplied 0xAARRGGBB, A8 images only use
+// its alpha. Color glyphs (emoji) are cached scaled and premultiplied and
+// only take the alpha of color as opacity. x and y are the pen origin on the
+// baseline. The caches are shared by the process, calls from several threads
+// are safe but take turns, gp_tiled_render draws in parallel.
+void gp_draw_image(gp_image_t *img, gp_run_t *runs, uint32_t len, double x,
+                   double y, uint32_t color);
+
+// Glyph outlines as signed distance fields at one reference size, so text
+// draws at any scale from a single atlas instead of a bitmap per size.
+// ref_size is the field's pixel size and spread its range in pixels, 0 for
+// the defaults (48 and 6). Needs FreeType 2.11, NULL otherwise. Not thread
+// safe, use an atlas per thread.
+typedef struct gp_sdf_atlas gp_sdf_atlas_t;
+gp_sdf_atlas_t *gp_sdf_atlas_create(uint32_t ref_size, uint32_t spread);
+void gp_sdf_atlas_destroy(gp_sdf_atlas_t *atlas);
+
+// gp_draw_image from atlas, runs drawn at scale times their shaped size.
+// Color glyphs (emoji) have no outline and are skipped.
+void gp_draw_sdf(gp_sdf_atlas_t *atlas, gp_image_t *img, gp_run_t *runs,
+                 uint32_t len, double x, double y, double scale,
+                 uint32_t color);
+
+// Tiled rendering for surfaces too large to draw in one go, e.g. posters and
+// documents to PNG. Glyphs are binned into square tiles which are drawn in
+// parallel, and finished rows are handed out top to bottom so the whole
+// surface is never allocated.
+typedef struct gp_tiled gp_tiled_t;
+
+// background is premultiplied 0xAARRGGBB. tile is the tile size in pixels,
+// 0 for 256.
+gp_tiled_t *gp_tiled_create(uint32_t width, uint32_t height,
+                            enum gp_image_format format, uint32_t background,
+                            uint32_t tile);
+
+void gp_tiled_destroy(gp_tiled_t *t);
+
+// Add runs as gp_draw_image would draw them. Glyph bitmaps are copied so
+// runs may be freed right after. Takes turns with gp_draw_image for the
+// caches, t itself is not thread safe.
+void gp_tiled_add(gp_tiled_t *t, gp_run_t *runs, uint32_t len, double x,
+                  double y, uint32_t color);
+
+// Gets the finished band of rows starting at y, which is reused once it
+// returns.
+typedef void (*gp_tiled_rows_fn)(const gp_image_t *band, uint32_t y,
+                                 void *user);
+
+// Draw everything added on threads threads (0 for one per core), the
+// calling one included. rows is called from the calling thread in order.
+// Only a few bands of tile rows are allocated at a time.
+void gp_tiled_render(gp_tiled_t *t, uint32_t threads, gp_tiled_rows_fn rows,
+                     void *user);
 
 // Helper to correctly load a fontset from a font pattern. Set with_color to
 // generate an emoji sorting suitable for fs_color.
 FcFontSet *gp_load_font(FcConfig *config, char *pattern, bool with_color);
 
+// gp_load_font for text in lang, cached so multilingual callers dont sort
+// per request. Each pattern is sorted once and lang only reorders that sort:
+// families the pattern names stay first, then fonts named for lang (picking
+// the regional CJK face), then ones covering it. Config rules matching on
+// lang are not applied, use gp_load_font with :lang= for those. NULL lang
+// gives the plain sort. The cache owns the fontsets, they stay valid until
+// gp_font_cache_clear. Thread safe.
+FcFontSet *gp_font_for_lang(FcConfig *config, const char *pattern,
+                            const char *lang, bool with_color);
+
+// Free every fontset of gp_font_for_lang. Runs using them must be gone.
+void gp_font_cache_clear(void);
+
 // analyze returns a set of runs composing all the information to properly
 // render the provided text.  runs_out will contain the chosen font for
 // rendering and glyphs to render.  fs and fs_color represent a list of fonts
 // providing full unicode coverage ordered by preference. fs_color is used for
-// emojis, if you prefer text representation use a text eomji fontset for
-// fs_color.  lang represents the language to use for unified codepoints (e.g.
-// CJK unified characters). getlocale() is reasonable if you do not have more
-// information.
+// clusters with emoji presentation (VS16, or Emoji_Presentation runes without
+// VS15), if you prefer text representation use a text eomji fontset for
+// fs_color. NULL sends everything through fs.  lang represents the language
+// to use for unified codepoints (e.g. CJK unified characters). getlocale() is
+// reasonable if you do not have more information. It is handed to HarfBuzz
+// for localized forms, picking glyph variants by font is up to fs, see
+// gp_font_for_lang.
 bool gp_analyze(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
                 const char *lang, gp_run_t **runs_out, uint32_t *len);
 
+// Clusters of an analyzed string in visual order, for hit testing and caret
+// positioning by binary search rather than walking glyphs.
+typedef struct gp_cluster_index {
+	uint32_t len; // clusters
+	double *x; // len + 1 left edges in pixels, x[len] is the total advance
+	uint32_t *lstart; // first logical rune of each cluster
+	uint32_t *lend; // one past its last logical rune
+	bool *rtl;
+	uint32_t runes_len;
+	uint32_t *l_to_c; // cluster of each logical rune
+	bool *graphemes; // runes_len + 1, set where a grapheme starts and at the end
+} gp_cluster_index_t;
+
+// gp_analyze, also building index if it isnt NULL. Free it with
+// gp_cluster_index_destroy.
+bool gp_analyze_index(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                      const char *lang, gp_run_t **runs_out, uint32_t *len,
+                      gp_cluster_index_t *index);
+
+// Logical caret offset (0 to runes_len) closest to x pixels from the start
+// of the line, always at a grapheme boundary.
+uint32_t gp_cluster_hit(const gp_cluster_index_t *index, double x);
+
+// x of the caret at logical offset, runes_len being the end of the text.
+// Offsets inside a grapheme get the caret of its start.
+double gp_cluster_caret_x(const gp_cluster_index_t *index, uint32_t offset);
+
+void gp_cluster_index_destroy(gp_cluster_index_t *index);
+
+// Fitting text into a width, cut with an ellipsis. The text is analyzed once
+// and can then be truncated to any number of widths.
+typedef struct gp_truncator gp_truncator_t;
+
+gp_truncator_t *gp_truncator_create(gp_runes_t runes, FcFontSet *fs,
+                                    FcFontSet *fs_color, const char *lang);
+void gp_truncator_destroy(gp_truncator_t *t);
+
+// Logical runes kept within max_width pixels, runes.len if nothing is cut.
+// width receives the width including the ellipsis. O(log n), from unshaped
+// cut widths, so it's an estimate: gp_truncate may keep one cut less when
+// the cluster at the cut shapes wider. Negative widths count as 0.
+uint32_t gp_truncate_fit(const gp_truncator_t *t, double max_width,
+                         double *width);
+
+// Runs of the kept text followed by the ellipsis, free with gp_run_destroy.
+// Only the ellipsis and the cluster at the cut are shaped.
+void gp_truncate(const gp_truncator_t *t, double max_width,
+                 gp_run_t **runs_out, uint32_t *len);
+
+// Results of gp_analyze_batch. Runs of every string share one allocation,
+// the runs of string i are runs[offsets[i]] up to runs[offsets[i + 1]].
+typedef struct gp_batch {
+	gp_run_t *runs;
+	uint32_t runs_len;
+	uint32_t *offsets; // len + 1 entries
+	uint32_t len;
+} gp_batch_t;
+
+// analyze many (short) strings sharing the same fontsets. Equivalent to
+// calling gp_analyze on each string, but runs of all strings are shaped
+// grouped by font so per font setup is paid once per batch.
+bool gp_analyze_batch(const gp_runes_t *strings, uint32_t len, FcFontSet *fs,
+                      FcFontSet *fs_color, const char *lang, gp_batch_t *out);
+
+// Serialize runs into buf, a versioned format without pointers which can be
+// written to disk or shared memory and read back in place on a host of the
+// same byte order. Fonts are stored by file, index and pixel size. Returns
+// the size needed, buf is only written when cap is large enough. 0 if runs
+// use more than 65536 fonts.
+size_t gp_serialize(const gp_run_t *runs, uint32_t len, uint8_t *buf,
+                    size_t cap);
+
+// Read only view of serialized runs. Nothing is copied, data (e.g. an mmap'd
+// file) must be 4 byte aligned and outlive the view.
+typedef struct gp_shaped {
+	const uint8_t *data;
+	size_t size;
+	uint32_t runs_len;
+	uint32_t fonts_len;
+} gp_shaped_t;
+
+typedef struct gp_shaped_run {
+	uint32_t start;
+	uint32_t end;
+	int16_t level;
+	enum gp_script script;
+	enum gp_width width;
+	const char *file; // points into data
+	int index;
+	double size; // pixel size
+	uint32_t glyphs_len;
+	const uint32_t *glyphs; // glyph ids in host order, points into data
+} gp_shaped_run_t;
+
+// Validate the header of serialized data. Returns false on anything not
+// written by a compatible gp_serialize.
+bool gp_shaped_open(gp_shaped_t *shaped, const uint8_t *data, size_t size);
+
+// Get run i without decoding its positions.
+bool gp_shaped_run(const gp_shaped_t *shaped, uint32_t i,
+                   gp_shaped_run_t *run);
+
+// Decode the (delta compressed) positions and clusters of run i, both must
+// have room for glyphs_len entries.
+bool gp_shaped_positions(const gp_shaped_t *shaped, uint32_t i,
+                         hb_glyph_position_t *pos, uint32_t *clusters);
+
+// Rebuild runs for drawing. Fonts are looked up in fs by file, index and
+// pixel size, missing ones get a pattern of their own, fs is not changed.
+// Free with gp_run_destroy.
+bool gp_shaped_to_runs(const gp_shaped_t *shaped, FcFontSet *fs,
+                       gp_run_t **runs_out, uint32_t *len);
+
+// Persistent cache of gp_analyze results, shared between runs of a program.
+// Entries are keyed by the fontsets, language and text and dropped when a
+// font file they use changes. Not thread safe.
+typedef struct gp_disk_cache gp_disk_cache_t;
+
+// Open or create the cache file at path. Returns NULL if it cant be opened.
+gp_disk_cache_t *gp_disk_cache_open(const char *path);
+
+void gp_disk_cache_close(gp_disk_cache_t *cache);
+
+// gp_analyze, but look the result up in cache first and store it there on a
+// miss. cache may be NULL.
+bool gp_analyze_cached(gp_disk_cache_t *cache, gp_runes_t runes,
+                       FcFontSet *fs, FcFontSet *fs_color, const char *lang,
+                       gp_run_t **runs_out, uint32_t *len);
+
+// Rewrite the cache file without replaced entries and ones whose fonts
+// changed.
+bool gp_disk_cache_compact(gp_disk_cache_t *cache);
+
+// Background warm up of font and shaping caches, so the first real strings
+// after startup dont pay for loading faces and shaping cold.
+typedef struct gp_prewarm gp_prewarm_t;
+
+// Run every line of the newline separated corpus file through gp_analyze on
+// threads background threads, stopping after budget_ms. fs and fs_color must
+// stay alive until gp_prewarm_wait. Returns NULL if the corpus cant be read.
+gp_prewarm_t *gp_prewarm(const char *corpus_path, FcFontSet *fs,
+                         FcFontSet *fs_color, const char *lang,
+                         uint32_t threads, uint32_t budget_ms);
+
+// Lines analyzed so far out of total. Returns false once warming stopped.
+bool gp_prewarm_progress(gp_prewarm_t *p, uint32_t *done, uint32_t *total);
+
+// Wait for the threads, or stop them early with cancel, and free p. Returns
+// the number of lines analyzed.
+uint32_t gp_prewarm_wait(gp_prewarm_t *p, bool cancel);
+
+// Pipelined layout for bulk text. gp_analyze is split into stages, each
+// with its own worker threads and connected by bounded lock-free queues, so
+// different paragraphs are decoded, analyzed, shaped and drawn at once.
+enum gp_pipeline_stage {
+	GP_STAGE_DECODE,  // utf8 to runes
+	GP_STAGE_ANALYZE, // bidi, classify and gp_itemize
+	GP_STAGE_SHAPE,
+	GP_STAGE_RASTER, // gp_draw_cairo into a fitting surface, optional
+	GP_STAGE_COUNT,
+};
+
+typedef struct gp_paragraph {
+	uint64_t id; // as pushed
+	const char *utf8;
+	uint32_t utf8_len;
+	bool ok;
+
+	gp_runes_t runes; // logical order
+	uint32_t *visual; // runes in visual order
+	gp_run_t *runs;
+	uint32_t runs_len;
+	cairo_surface_t *surface; // GP_STAGE_RASTER only, origin at top left
+} gp_paragraph_t;
+
+typedef struct gp_pipeline gp_pipeline_t;
+
+typedef struct gp_pipeline_opts {
+	FcFontSet *fs;
+	FcFontSet *fs_color;
+	const char *lang; // as for gp_analyze, must outlive the pipeline
+	bool raster; // run GP_STAGE_RASTER
+	uint32_t threads[GP_STAGE_COUNT]; // workers per stage, 0 means 1
+	uint32_t queue_cap; // paragraphs waiting per stage, 0 means 64
+	// Called from the last stage's workers with each finished paragraph,
+	// in no particular order. Free it with gp_paragraph_destroy.
+	void (*done)(gp_paragraph_t *para, void *user);
+	void *user;
+} gp_pipeline_opts_t;
+
+gp_pipeline_t *gp_pipeline_create(const gp_pipeline_opts_t *opts);
+
+// Queue a paragraph, blocking while the first stage is full. utf8 must stay
+// alive until its paragraph is done. Paragraphs over 4095 runes, the limit
+// of gp_analyze, come back with ok false and no runes, split them first.
+void gp_pipeline_push(gp_pipeline_t *p, uint64_t id, const char *utf8,
+                      uint32_t len);
+
+// Wait for every pushed paragraph to be done and free p.
+void gp_pipeline_finish(gp_pipeline_t *p);
+
+void gp_paragraph_destroy(gp_paragraph_t *para);
+
+// A whole document laid out paragraph by paragraph. Paragraphs end at
+// paragraph separators (newlines, U+2029, ...) which are left out of them,
+// overly long ones are split.
+typedef struct gp_document {
+	gp_runes_t runes; // whole text, logical order
+	uint32_t len; // paragraphs
+	uint32_t *starts; // first rune of each paragraph
+	uint32_t *ends;
+	// Runs of paragraph i are runs[run_offsets[i]] up to
+	// runs[run_offsets[i + 1]], their start and end are relative to the
+	// paragraph.
+	gp_run_t *runs;
+	uint32_t runs_len;
+	uint32_t *run_offsets;
+} gp_document_t;
+
+// Lay out utf8 as independent paragraphs on threads threads (0 for one per
+// core). Paragraphs are scheduled by work stealing and the results merged
+// in order.
+bool gp_layout_document(const char *utf8, size_t len, FcFontSet *fs,
+                        FcFontSet *fs_color, const char *lang,
+                        uint32_t threads, gp_document_t *out);
+
+void gp_document_destroy(gp_document_t *doc);
+
+// Virtualized layout for texts far larger than what is shown, e.g. logs.
+// Only lines around the viewport are laid out, so scrolling costs the same
+// no matter how long the text is. Lines end at '\n'.
+typedef struct gp_view gp_view_t;
+
+typedef struct gp_view_line {
+	uint64_t start; // byte offsets into the text
+	uint64_t end;
+	gp_run_t *runs; // owned by the view
+	uint32_t len;
+	double y; // top, relative to the viewport
+	double height;
+	double ascent; // baseline is at y + ascent
+} gp_view_line_t;
+
+// utf8 must outlive the view (it may well be mmap'd). line_height is the
+// minimum height of a line, budget the bytes of laid out lines to keep
+// cached (0 for a default).
+gp_view_t *gp_view_create(const char *utf8, size_t len, FcFontSet *fs,
+                          FcFontSet *fs_color, const char *lang,
+                          double line_height, size_t budget);
+
+void gp_view_destroy(gp_view_t *v);
+
+// Jump to the line at fraction (0 to 1) of the text, e.g. a scrollbar drag.
+void gp_view_scroll_to(gp_view_t *v, double fraction);
+
+// Scroll by dy pixels.
+void gp_view_scroll_by(gp_view_t *v, double dy);
+
+// Lay out the lines visible in a viewport of height pixels into lines,
+// returning how many there are. Runs stay valid until the next call on v.
+uint32_t gp_view_layout(gp_view_t *v, double height, gp_view_line_t *lines,
+                        uint32_t cap);
+
+// Estimated position of the viewport and height of the whole text, for a
+// scrollbar. Based on the lines laid out so far.
+void gp_view_scrollbar(gp_view_t *v, double *top, double *total);
+
+// Bytes held by libgp's process wide caches. Runs, batches, documents and
+// views belong to the caller and are not counted.
+typedef struct gp_memory_stats {
+	size_t fontsets; // gp_font_for_lang fontsets and sorts, estimated
+	size_t charsets; // coverage of their fonts, mostly in fontconfig's mmap
+	size_t blobs; // mapped font files, page cache shared with other processes
+	size_t shaped; // shape cache entries
+	size_t glyphs; // gp_draw_image coverage and color bitmaps
+	size_t tables; // lookup tables of the glyph caches
+	uint32_t faces; // open FreeType and cairo faces, their size is hidden
+} gp_memory_stats_t;
+
+void gp_memory_stats(gp_memory_stats_t *stats);
+
+// What gp_trim releases, each level including the ones before. Everything
+// is rebuilt on demand, later levels cost more to rebuild.
+enum gp_trim_level {
+	GP_TRIM_LOW, // shaped results and glyph bitmaps
+	GP_TRIM_MEDIUM, // open faces, scaled fonts and font mappings
+	GP_TRIM_CRITICAL, // the sorts behind gp_font_for_lang
+};
+
+// Release caches down to level, e.g. on a cgroup memory.pressure event.
+// Fontsets and runs handed out stay valid. Returns the bytes released as
+// gp_memory_stats counts them. Safe to call from any thread.
+size_t gp_trim(enum gp_trim_level level);
+
 // Free data from gp_run_t
 void gp_run_destroy(gp_run_t *runs, uint32_t len);
+
+// Free data from gp_batch_t
+void gp_batch_destroy(gp_batch_t *batch);
 #endif
@@ -0,0 +1,495 @@
+#include <hb.h>
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gp.h"
+
+// From gp_serial.c.
+bool shaped_to_runs(const gp_shaped_t *shaped, FcFontSet *fs,
+                    FcFontSet *fs_color, bool strict, gp_run_t **runs_out,
+                    uint32_t *len);
+
+// Persistent cache of gp_analyze results. The file is a header followed by
+// appended entries, each 8 byte aligned:
+//
+//   cache_entry   32 bytes, see below
+//   runes         runes_len * 4, the text to compare on lookup
+//   mtimes        runs_len * 8 (after padding), font file mtime of each run
+//   runs          gp_serialize output
+//
+// Headers are native endian, the cache is local to one machine anyway.
+// Entries are only ever appended, stale and replaced ones stay in the file
+// until gp_disk_cache_compact rewrites it.
+#define GP_CACHE_MAGIC 0x43535047       // "GPSC"
+#define GP_CACHE_ENTRY_MAGIC 0x45435047 // "GPCE"
+#define GP_CACHE_VERSION 1
+#define GP_CACHE_HEADER 16
+
+typedef struct cache_entry {
+	uint32_t magic;
+	uint32_t len; // whole entry including padding
+	uint64_t key;
+	uint32_t runes_len;
+	uint32_t runs_len;
+	uint64_t checksum; // of everything after the entry header
+} cache_entry;
+
+typedef struct cache_mtime {
+	char *file;
+	int64_t mtime;
+} cache_mtime;
+
+struct gp_disk_cache {
+	char *path;
+	int fd;
+	uint8_t *map;
+	size_t map_len;
+
+	// key -> entry offset, open addressed. offset 0 is the file header so
+	// it marks empty slots.
+	uint64_t *keys;
+	uint64_t *offsets;
+	uint32_t index_cap;
+	uint32_t index_len;
+
+	// font file mtimes, stat'd once per mapping of the file so fonts
+	// updated while the cache is open are noticed on the next remap.
+	cache_mtime *mtimes;
+	uint32_t mtimes_len;
+	uint32_t mtimes_cap;
+};
+
+#define FNV_OFFSET 0xcbf29ce484222325ull
+#define FNV_PRIME 0x100000001b3ull
+
+static uint64_t fnv64(uint64_t h, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	for (size_t i = 0; i < len; i++) {
+		h = (h ^ p[i]) * FNV_PRIME;
+	}
+	return h;
+}
+
+static size_t pad8(size_t n)
+{
+	return (n + 7) & ~(size_t)7;
+}
+
+// Fontsets are identified by what shaping depends on, not their address, so
+// keys stay valid across processes.
+static uint64_t fontset_hash(FcFontSet *fs)
+{
+	uint64_t h = FNV_OFFSET;
+	for (int i = 0; i < fs->nfont; i++) {
+		char *file = "";
+		int index = 0;
+		double px = 0.0;
+		FcMatrix *mat;
+		FcPatternGetString(fs->fonts[i], FC_FILE, 0, (FcChar8 **)&file);
+		FcPatternGetInteger(fs->fonts[i], FC_INDEX, 0, &index);
+		FcPatternGetDouble(fs->fonts[i], FC_PIXEL_SIZE, 0, &px);
+		h = fnv64(h, file, strlen(file) + 1);
+		h = fnv64(h, &index, sizeof(index));
+		h = fnv64(h, &px, sizeof(px));
+		if (FcPatternGetMatrix(fs->fonts[i], FC_MATRIX, 0, &mat) ==
+		    FcResultMatch) {
+			h = fnv64(h, mat, sizeof(*mat));
+		}
+	}
+	return h;
+}
+
+static int64_t file_mtime(gp_disk_cache_t *cache, const char *file)
+{
+	for (uint32_t i = 0; i < cache->mtimes_len; i++) {
+		if (strcmp(cache->mtimes[i].file, file) == 0) {
+			return cache->mtimes[i].mtime;
+		}
+	}
+	struct stat st;
+	int64_t mtime = -1;
+	if (stat(file, &st) == 0) {
+		mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+	}
+	if (cache->mtimes_len == cache->mtimes_cap) {
+		cache->mtimes_cap = cache->mtimes_cap * 2 + 16;
+		cache->mtimes = realloc(cache->mtimes,
+		                        sizeof(cache_mtime) * cache->mtimes_cap);
+	}
+	cache->mtimes[cache->mtimes_len++] = (cache_mtime){strdup(file), mtime};
+	return mtime;
+}
+
+static void mtimes_clear(gp_disk_cache_t *cache)
+{
+	for (uint32_t i = 0; i < cache->mtimes_len; i++) {
+		free(cache->mtimes[i].file);
+	}
+	cache->mtimes_len = 0;
+}
+
+static void index_put(gp_disk_cache_t *cache, uint64_t key, uint64_t offset)
+{
+	if ((cache->index_len + 1) * 4 > cache->index_cap * 3) {
+		uint32_t old_cap = cache->index_cap;
+		uint64_t *old_keys = cache->keys, *old_offsets = cache->offsets;
+		cache->index_cap = old_cap ? old_cap * 2 : 256;
+		cache->keys = calloc(cache->index_cap, sizeof(uint64_t));
+		cache->offsets = calloc(cache->index_cap, sizeof(uint64_t));
+		cache->index_len = 0;
+		for (uint32_t i = 0; i < old_cap; i++) {
+			if (old_offsets[i]) {
+				index_put(cache, old_keys[i], old_offsets[i]);
+			}
+		}
+		free(old_keys);
+		free(old_offsets);
+	}
+	uint32_t mask = cache->index_cap - 1;
+	uint32_t i = key & mask;
+	while (cache->offsets[i] && cache->keys[i] != key) {
+		i = (i + 1) & mask;
+	}
+	if (!cache->offsets[i]) {
+		cache->index_len++;
+	}
+	// Later entries replace earlier ones with the same key.
+	cache->keys[i] = key;
+	cache->offsets[i] = offset;
+}
+
+static uint64_t index_get(gp_disk_cache_t *cache, uint64_t key)
+{
+	if (!cache->index_cap) {
+		return 0;
+	}
+	uint32_t mask = cache->index_cap - 1;
+	for (uint32_t i = key & mask; cache->offsets[i]; i = (i + 1) & mask) {
+		if (cache->keys[i] == key) {
+			return cache->offsets[i];
+		}
+	}
+	return 0;
+}
+
+static void index_clear(gp_disk_cache_t *cache)
+{
+	free(cache->keys);
+	free(cache->offsets);
+	cache->keys = cache->offsets = NULL;
+	cache->index_cap = cache->index_len = 0;
+}
+
+static bool cache_map(gp_disk_cache_t *cache)
+{
+	struct stat st;
+	mtimes_clear(cache);
+	if (cache->map) {
+		munmap(cache->map, cache->map_len);
+		cache->map = NULL;
+		cache->map_len = 0;
+	}
+	if (fstat(cache->fd, &st) != 0) {
+		return false;
+	}
+	if (st.st_size == 0) {
+		return true;
+	}
+	void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, cache->fd, 0);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+	// Lookups jump around the file.
+	madvise(addr, st.st_size, MADV_RANDOM);
+	cache->map = addr;
+	cache->map_len = st.st_size;
+	return true;
+}
+
+// Length of the entry at off, 0 if its header is garbage or it runs past
+// the end of the file. valid is false if its contents dont match the
+// checksum.
+static uint32_t entry_check(gp_disk_cache_t *cache, size_t off, bool *valid)
+{
+	*valid = false;
+	if (cache->map_len - off < sizeof(cache_entry)) {
+		return 0;
+	}
+	const cache_entry *e = (const cache_entry *)(cache->map + off);
+	size_t fixed = sizeof(cache_entry) + pad8((size_t)e->runes_len * 4) +
+	               (size_t)e->runs_len * 8;
+	if (e->magic != GP_CACHE_ENTRY_MAGIC || e->len % 8 != 0 ||
+	    e->len > cache->map_len - off || e->len < fixed) {
+		return 0;
+	}
+	uint64_t sum = fnv64(FNV_OFFSET, e + 1, e->len - sizeof(cache_entry));
+	*valid = sum == e->checksum;
+	return e->len;
+}
+
+// Offset of the next valid entry after a garbled one at off, 0 if there is
+// none.
+static size_t entry_resync(gp_disk_cache_t *cache, size_t off)
+{
+	for (off += 8; off < cache->map_len; off += 8) {
+		bool valid;
+		if (entry_check(cache, off, &valid) && valid) {
+			return off;
+		}
+	}
+	return 0;
+}
+
+// Index every entry. Corrupt entries with valid ones after them are skipped,
+// a torn tail left by a crashed writer is dropped. Call with the file
+// locked.
+static bool cache_scan(gp_disk_cache_t *cache)
+{
+	index_clear(cache);
+	size_t off = GP_CACHE_HEADER;
+	while (off < cache->map_len) {
+		bool valid;
+		uint32_t len = entry_check(cache, off, &valid);
+		if (valid) {
+			const cache_entry *e = (const cache_entry *)(cache->map + off);
+			index_put(cache, e->key, off);
+			off += len;
+			continue;
+		}
+		size_t next = len && off + len < cache->map_len
+		                      ? off + len
+		                      : entry_resync(cache, off);
+		if (!next) {
+			if (ftruncate(cache->fd, off) != 0) {
+				return false;
+			}
+			return cache_map(cache);
+		}
+		off = next;
+	}
+	return true;
+}
+
+static bool cache_init_file(int fd)
+{
+	uint32_t header[4] = {GP_CACHE_MAGIC, GP_CACHE_VERSION, 0, 0};
+	return ftruncate(fd, 0) == 0 &&
+	       pwrite(fd, header, sizeof(header), 0) == sizeof(header);
+}
+
+static bool cache_header_ok(gp_disk_cache_t *cache)
+{
+	uint32_t header[4];
+	if (cache->map_len < GP_CACHE_HEADER) {
+		return false;
+	}
+	memcpy(header, cache->map, sizeof(header));
+	return header[0] == GP_CACHE_MAGIC && header[1] == GP_CACHE_VERSION;
+}
+
+gp_disk_cache_t *gp_disk_cache_open(const char *path)
+{
+	int fd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		return NULL;
+	}
+	gp_disk_cache_t *cache = calloc(1, sizeof(gp_disk_cache_t));
+	cache->path = strdup(path);
+	cache->fd = fd;
+
+	flock(fd, LOCK_EX);
+	bool ok = cache_map(cache);
+	if (ok && !cache_header_ok(cache)) {
+		// new file or an older version, start over.
+		ok = cache_init_file(fd) && cache_map(cache);
+	}
+	ok = ok && cache_scan(cache);
+	flock(fd, LOCK_UN);
+	if (!ok) {
+		gp_disk_cache_close(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+void gp_disk_cache_close(gp_disk_cache_t *cache)
+{
+	if (!cache) {
+		return;
+	}
+	if (cache->map) {
+		munmap(cache->map, cache->map_len);
+	}
+	close(cache->fd);
+	index_clear(cache);
+	mtimes_clear(cache);
+	free(cache->mtimes);
+	free(cache->path);
+	free(cache);
+}
+
+static const uint64_t *entry_mtimes(const cache_entry *e)
+{
+	return (const uint64_t *)((const uint8_t *)(e + 1) +
+	                          pad8((size_t)e->runes_len * 4));
+}
+
+// Open the runs of an entry, failing if any font changed since it was
+// written.
+static bool entry_runs(gp_disk_cache_t *cache, const cache_entry *e,
+                       gp_shaped_t *shaped)
+{
+	const uint64_t *mtimes = entry_mtimes(e);
+	const uint8_t *data = (const uint8_t *)(mtimes + e->runs_len);
+	size_t size = (const uint8_t *)e + e->len - data;
+	if (!gp_shaped_open(shaped, data, size) ||
+	    shaped->runs_len != e->runs_len) {
+		return false;
+	}
+	for (uint32_t i = 0; i < e->runs_len; i++) {
+		gp_shaped_run_t run;
+		if (!gp_shaped_run(shaped, i, &run) ||
+		    file_mtime(cache, run.file) != (int64_t)mtimes[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool cache_append(gp_disk_cache_t *cache, uint64_t key,
+                         gp_runes_t runes, gp_run_t *runs, uint32_t len)
+{
+	size_t runes_size = pad8((size_t)runes.len * 4);
+	size_t blob = gp_serialize(runs, len, NULL, 0);
+	size_t total = pad8(sizeof(cache_entry) + runes_size + len * 8 + blob);
+	if (!blob || total > UINT32_MAX) {
+		return false;
+	}
+	uint8_t *buf = calloc(1, total);
+	cache_entry *e = (cache_entry *)buf;
+	memcpy(e + 1, runes.data, (size_t)runes.len * 4);
+	uint64_t *mtimes = (uint64_t *)(buf + sizeof(cache_entry) + runes_size);
+	for (uint32_t i = 0; i < len; i++) {
+		const gp_font_t *font = gp_font_get(runs[i].font);
+		mtimes[i] = file_mtime(cache, font ? font->file : "");
+	}
+	gp_serialize(runs, len, (uint8_t *)(mtimes + len), blob);
+	*e = (cache_entry){
+	        .magic = GP_CACHE_ENTRY_MAGIC,
+	        .len = total,
+	        .key = key,
+	        .runes_len = runes.len,
+	        .runs_len = len,
+	        .checksum = fnv64(FNV_OFFSET, e + 1, total - sizeof(cache_entry)),
+	};
+
+	flock(cache->fd, LOCK_EX);
+	off_t off = lseek(cache->fd, 0, SEEK_END);
+	bool ok = off >= GP_CACHE_HEADER &&
+	          write(cache->fd, buf, total) == (ssize_t)total;
+	flock(cache->fd, LOCK_UN);
+	free(buf);
+	// Remap to see the new entry (and whatever other processes appended,
+	// those are picked up on the next open).
+	if (!ok || !cache_map(cache)) {
+		return false;
+	}
+	index_put(cache, key, off);
+	return true;
+}
+
+bool gp_analyze_cached(gp_disk_cache_t *cache, gp_runes_t runes,
+                       FcFontSet *fs, FcFontSet *fs_color, const char *lang,
+                       gp_run_t **runs_out, uint32_t *len)
+{
+	if (!cache) {
+		return gp_analyze(runes, fs, fs_color, lang, runs_out, len);
+	}
+	uint64_t key = fontset_hash(fs);
+	if (fs_color) {
+		uint64_t color = fontset_hash(fs_color);
+		key = fnv64(key, &color, sizeof(color));
+	}
+	key = fnv64(key, lang ? lang : "", lang ? strlen(lang) + 1 : 1);
+	key = fnv64(key, runes.data, (size_t)runes.len * 4);
+
+	uint64_t off = index_get(cache, key);
+	if (off && off < cache->map_len) {
+		const cache_entry *e = (const cache_entry *)(cache->map + off);
+		gp_shaped_t shaped;
+		if (e->runes_len == runes.len &&
+		    memcmp(e + 1, runes.data, (size_t)runes.len * 4) == 0 &&
+		    entry_runs(cache, e, &shaped) &&
+		    shaped_to_runs(&shaped, fs, fs_color, true, runs_out, len)) {
+			return true;
+		}
+	}
+
+	if (!gp_analyze(runes, fs, fs_color, lang, runs_out, len)) {
+		return false;
+	}
+	cache_append(cache, key, runes, *runs_out, *len);
+	return true;
+}
+
+bool gp_disk_cache_compact(gp_disk_cache_t *cache)
+{
+	size_t tmp_len = strlen(cache->path) + 5;
+	char *tmp = malloc(tmp_len);
+	snprintf(tmp, tmp_len, "%s.tmp", cache->path);
+
+	flock(cache->fd, LOCK_EX);
+	// Pick up entries other processes appended since we mapped.
+	bool ok = cache_map(cache) && cache_scan(cache);
+	int fd = ok ? open(tmp, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) : -1;
+	ok = fd >= 0 && cache_init_file(fd);
+	off_t at = GP_CACHE_HEADER;
+	// Only the latest entry per key is indexed, keep those whose fonts
+	// are unchanged.
+	for (uint32_t i = 0; ok && i < cache->index_cap; i++) {
+		if (!cache->offsets[i]) {
+			continue;
+		}
+		const cache_entry *e =
+		        (const cache_entry *)(cache->map + cache->offsets[i]);
+		gp_shaped_t shaped;
+		if (!entry_runs(cache, e, &shaped)) {
+			continue;
+		}
+		ok = pwrite(fd, e, e->len, at) == (ssize_t)e->len;
+		at += e->len;
+	}
+	ok = ok && fsync(fd) == 0 && rename(tmp, cache->path) == 0;
+	if (!ok) {
+		if (fd >= 0) {
+			close(fd);
+			unlink(tmp);
+		}
+		flock(cache->fd, LOCK_UN);
+		free(tmp);
+		return false;
+	}
+
+	// Processes still holding the old file keep appending to it until they
+	// reopen, their entries are lost but nothing breaks.
+	flock(fd, LOCK_EX);
+	flock(cache->fd, LOCK_UN);
+	close(cache->fd);
+	cache->fd = fd;
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_APPEND);
+	ok = cache_map(cache) && cache_scan(cache);
+	flock(fd, LOCK_UN);
+	free(tmp);
+	return ok;
+}
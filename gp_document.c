@@ -0,0 +1,284 @@
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "gp.h"
+
+// Stages of gp_analyze, from gp.c.
+bool analyze_runs(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                  uint32_t *vstr, gp_run_t *runs, uint32_t *len);
+void shape_runs(gp_runes_t vrunes, const char *lang, gp_run_t *runs,
+                uint32_t len);
+
+// Same limit as gp_analyze, longer paragraphs are split.
+#define GP_DOCUMENT_MAX_RUNES 4095
+
+// Where the runs of a paragraph ended up.
+typedef struct doc_result {
+	uint32_t worker;
+	uint32_t offset; // in the worker's runs
+	uint32_t len;
+} doc_result;
+
+// Each worker owns a range of paragraphs, packed as lo | hi << 32 so the
+// owner taking from the front and thieves taking the back half agree
+// through a single CAS.
+typedef struct doc_worker {
+	_Alignas(64) _Atomic uint64_t range;
+	pthread_t thread;
+	bool started;
+	uint32_t index;
+	struct doc_layout *l;
+
+	// Scratch reused for every paragraph, then the finished runs.
+	uint32_t *vstr;
+	gp_run_t *scratch;
+	gp_run_t *runs;
+	uint32_t runs_len;
+	uint32_t runs_cap;
+} doc_worker;
+
+typedef struct doc_layout {
+	gp_document_t *doc;
+	FcFontSet *fs;
+	FcFontSet *fs_color;
+	const char *lang;
+	doc_result *results;
+	doc_worker *workers;
+	uint32_t workers_len;
+	atomic_bool failed;
+} doc_layout;
+
+static uint64_t range_pack(uint32_t lo, uint32_t hi)
+{
+	return lo | (uint64_t)hi << 32;
+}
+
+static bool range_pop(doc_worker *w, uint32_t *i)
+{
+	uint64_t r = atomic_load(&w->range);
+	for (;;) {
+		uint32_t lo = r, hi = r >> 32;
+		if (lo >= hi) {
+			return false;
+		}
+		if (atomic_compare_exchange_weak(&w->range, &r,
+		                                 range_pack(lo + 1, hi))) {
+			*i = lo;
+			return true;
+		}
+	}
+}
+
+// Take the back half of some other worker's paragraphs.
+static bool range_steal(doc_layout *l, doc_worker *w)
+{
+	for (uint32_t k = 1; k < l->workers_len; k++) {
+		doc_worker *victim = &l->workers[(w->index + k) % l->workers_len];
+		uint64_t r = atomic_load(&victim->range);
+		for (;;) {
+			uint32_t lo = r, hi = r >> 32;
+			if (lo >= hi) {
+				break;
+			}
+			uint32_t mid = lo + (hi - lo) / 2;
+			if (atomic_compare_exchange_weak(&victim->range, &r,
+			                                 range_pack(lo, mid))) {
+				// Our range is empty so nobody else touches it.
+				atomic_store(&w->range, range_pack(mid, hi));
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+static void layout_paragraph(doc_layout *l, doc_worker *w, uint32_t i)
+{
+	gp_document_t *doc = l->doc;
+	gp_runes_t runes = {doc->runes.data + doc->starts[i],
+	                    doc->ends[i] - doc->starts[i]};
+	uint32_t n = 0;
+	if (runes.len) {
+		if (!analyze_runs(runes, l->fs, l->fs_color, w->vstr, w->scratch,
+		                  &n)) {
+			atomic_store(&l->failed, true);
+			n = 0;
+		}
+		gp_runes_t vrunes = {w->vstr, runes.len};
+		shape_runs(vrunes, l->lang, w->scratch, n);
+	}
+	if (w->runs_len + n > w->runs_cap) {
+		w->runs_cap = (w->runs_cap + n) * 2;
+		w->runs = realloc(w->runs, sizeof(gp_run_t) * w->runs_cap);
+	}
+	memcpy(&w->runs[w->runs_len], w->scratch, sizeof(gp_run_t) * n);
+	l->results[i] = (doc_result){w->index, w->runs_len, n};
+	w->runs_len += n;
+}
+
+static void *doc_thread(void *arg)
+{
+	doc_worker *w = arg;
+	uint32_t i;
+	for (;;) {
+		while (range_pop(w, &i)) {
+			layout_paragraph(w->l, w, i);
+		}
+		if (!range_steal(w->l, w)) {
+			break;
+		}
+	}
+	return NULL;
+}
+
+static bool is_paragraph_sep(uint32_t rune)
+{
+	return rune == '\n' || rune == '\r' || (rune >= 0x1C && rune <= 0x1E) ||
+	       rune == 0x85 || rune == 0x2029;
+}
+
+static void add_paragraph(gp_document_t *doc, uint32_t *cap, uint32_t start,
+                          uint32_t end)
+{
+	if (doc->len == *cap) {
+		*cap = *cap * 2 + 1024;
+		doc->starts = realloc(doc->starts, sizeof(uint32_t) * *cap);
+		doc->ends = realloc(doc->ends, sizeof(uint32_t) * *cap);
+	}
+	doc->starts[doc->len] = start;
+	doc->ends[doc->len] = end;
+	doc->len++;
+}
+
+// Split at paragraph separators (bidi class B). Paragraphs too long to
+// analyze at once are cut at a space, bidi and shaping wont cross the cut.
+static void split_paragraphs(gp_document_t *doc)
+{
+	uint32_t cap = 0, start = 0;
+	const uint32_t *r = doc->runes.data;
+	for (uint32_t i = 0; i <= doc->runes.len; i++) {
+		if (i < doc->runes.len && !is_paragraph_sep(r[i])) {
+			if (i - start < GP_DOCUMENT_MAX_RUNES) {
+				continue;
+			}
+			uint32_t cut = i;
+			while (cut > start + GP_DOCUMENT_MAX_RUNES / 2 &&
+			       r[cut - 1] != ' ') {
+				cut--;
+			}
+			if (r[cut - 1] != ' ') {
+				cut = i;
+			}
+			add_paragraph(doc, &cap, start, cut);
+			start = cut;
+			continue;
+		}
+		add_paragraph(doc, &cap, start, i);
+		if (i + 1 < doc->runes.len && r[i] == '\r' && r[i + 1] == '\n') {
+			i++;
+		}
+		start = i + 1;
+	}
+}
+
+bool gp_layout_document(const char *utf8, size_t len, FcFontSet *fs,
+                        FcFontSet *fs_color, const char *lang,
+                        uint32_t threads, gp_document_t *out)
+{
+	if (len > UINT32_MAX) {
+		return false;
+	}
+	gp_document_t *doc = out;
+	memset(doc, 0, sizeof(*doc));
+	doc->runes.data = malloc(sizeof(uint32_t) * (len + 1));
+	gp_utf8_to_runes(utf8, len, len, doc->runes.data, &doc->runes.len);
+	split_paragraphs(doc);
+
+	if (!threads) {
+		long n = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = n > 0 ? n : 1;
+	}
+	if (threads > doc->len) {
+		threads = doc->len ? doc->len : 1;
+	}
+	doc_layout l = {
+	        .doc = doc,
+	        .fs = fs,
+	        .fs_color = fs_color,
+	        .lang = lang,
+	        .results = calloc(doc->len + 1, sizeof(doc_result)),
+	        .workers = calloc(threads, sizeof(doc_worker)),
+	        .workers_len = threads,
+	};
+	for (uint32_t t = 0; t < threads; t++) {
+		doc_worker *w = &l.workers[t];
+		w->index = t;
+		w->l = &l;
+		w->vstr = malloc(sizeof(uint32_t) * (GP_DOCUMENT_MAX_RUNES + 1));
+		w->scratch = malloc(sizeof(gp_run_t) * (GP_DOCUMENT_MAX_RUNES + 1));
+		// Even split by paragraph count, stealing evens out the rest.
+		uint64_t lo = (uint64_t)doc->len * t / threads;
+		uint64_t hi = (uint64_t)doc->len * (t + 1) / threads;
+		atomic_init(&w->range, range_pack(lo, hi));
+	}
+	// The calling thread is worker 0.
+	for (uint32_t t = 1; t < threads; t++) {
+		l.workers[t].started = pthread_create(&l.workers[t].thread, NULL,
+		                                      doc_thread, &l.workers[t]) == 0;
+	}
+	doc_thread(&l.workers[0]);
+	// Workers that failed to start just get their range stolen, but only
+	// while someone is still looking. Finish anything left here.
+	for (uint32_t t = 1; t < threads; t++) {
+		if (l.workers[t].started) {
+			pthread_join(l.workers[t].thread, NULL);
+		}
+	}
+	doc_thread(&l.workers[0]);
+
+	// Merge in document order.
+	doc->run_offsets = malloc(sizeof(uint32_t) * (doc->len + 1));
+	for (uint32_t i = 0; i < doc->len; i++) {
+		doc->run_offsets[i] = doc->runs_len;
+		doc->runs_len += l.results[i].len;
+	}
+	doc->run_offsets[doc->len] = doc->runs_len;
+	doc->runs = malloc(sizeof(gp_run_t) * (doc->runs_len + 1));
+	for (uint32_t i = 0; i < doc->len; i++) {
+		doc_result *res = &l.results[i];
+		memcpy(&doc->runs[doc->run_offsets[i]],
+		       &l.workers[res->worker].runs[res->offset],
+		       sizeof(gp_run_t) * res->len);
+	}
+
+	for (uint32_t t = 0; t < threads; t++) {
+		free(l.workers[t].vstr);
+		free(l.workers[t].scratch);
+		free(l.workers[t].runs);
+	}
+	free(l.workers);
+	free(l.results);
+	if (atomic_load(&l.failed)) {
+		gp_document_destroy(doc);
+		return false;
+	}
+	return true;
+}
+
+void gp_document_destroy(gp_document_t *doc)
+{
+	gp_run_destroy(doc->runs, doc->runs_len);
+	free(doc->runes.data);
+	free(doc->starts);
+	free(doc->ends);
+	free(doc->run_offsets);
+	memset(doc, 0, sizeof(*doc));
+}
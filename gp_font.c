@@ -0,0 +1,337 @@
+#include <hb.h>
+#include <cairo/cairo.h>
+#include <cairo/cairo-ft.h>
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "gp.h"
+
+// From gp.c.
+hb_blob_t *blob_for_file(const char *file);
+bool shapes_linearly(FcPattern *pattern);
+
+// Fonts of runs by id. Records are allocated in chunks that never move or go
+// away, so once an id is out its record is read without locking. Only the
+// HarfBuzz and cairo objects come and go, under fonts_lock.
+#define GP_FONT_CHUNK 256
+#define GP_FONT_CHUNKS 1024
+// Scaled fonts per record, one per set of font options drawn with. Targets
+// rarely differ, past this the oldest goes.
+#define GP_FONT_CAIRO 4
+
+typedef struct font_rec {
+	gp_font_t font;
+	uint32_t render; // hash of the pattern's render_props
+	hb_font_t *hb; // at the pattern's size
+	hb_font_t *unscaled; // at units per em, NULL unless font.linear
+	cairo_scaled_font_t *cairo[GP_FONT_CAIRO];
+	cairo_font_options_t *cairo_options[GP_FONT_CAIRO];
+	uint32_t cairo_next; // slot to replace when all are taken
+} font_rec;
+
+static font_rec *font_chunks[GP_FONT_CHUNKS];
+static uint32_t fonts_len = 1; // 0 is no font
+
+// Id by content, open addressed, 0 for an empty slot. Patterns of the same
+// font drawn the same way (reloaded fontsets, re-sorts after gp_trim, the
+// disk cache) share a record, so records only grow with the fonts actually
+// in use.
+static uint32_t *font_slots;
+static uint32_t font_slots_cap;
+static pthread_mutex_t fonts_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// What cairo draws differently with, besides the file, size and matrix.
+// The cairo face is made from the record's pattern, so patterns that differ
+// in these need records of their own.
+static FcObjectSet *render_props;
+static pthread_once_t render_props_once = PTHREAD_ONCE_INIT;
+
+static void render_props_init(void)
+{
+	render_props = FcObjectSetBuild(
+	        FC_EMBOLDEN, FC_ANTIALIAS, FC_HINTING, FC_HINT_STYLE, FC_AUTOHINT,
+	        FC_RGBA, FC_LCD_FILTER, FC_FONT_VARIATIONS, NULL);
+}
+
+static font_rec *font_rec_for(uint32_t id)
+{
+	if (id == 0 || id >= GP_FONT_CHUNK * GP_FONT_CHUNKS) {
+		return NULL;
+	}
+	font_rec *chunk = font_chunks[id / GP_FONT_CHUNK];
+	return chunk ? &chunk[id % GP_FONT_CHUNK] : NULL;
+}
+
+static uint64_t font_hash(const font_rec *rec)
+{
+	const gp_font_t *font = &rec->font;
+	// FNV-1a
+	uint64_t h = 0xcbf29ce484222325ull;
+	for (const char *c = font->file; *c; c++) {
+		h = (h ^ (uint8_t)*c) * 0x100000001b3ull;
+	}
+	double d[3] = {font->size, font->scale_x, font->scale_y};
+	uint64_t bits[3];
+	memcpy(bits, d, sizeof(bits));
+	h = (h ^ (uint64_t)font->index) * 0x100000001b3ull;
+	h = (h ^ rec->render) * 0x100000001b3ull;
+	for (int i = 0; i < 3; i++) {
+		h = (h ^ bits[i]) * 0x100000001b3ull;
+	}
+	return h;
+}
+
+static bool font_eql(const font_rec *lr, const font_rec *rr)
+{
+	const gp_font_t *l = &lr->font, *r = &rr->font;
+	return l->index == r->index && l->size == r->size &&
+	       l->scale_x == r->scale_x && l->scale_y == r->scale_y &&
+	       lr->render == rr->render && strcmp(l->file, r->file) == 0 &&
+	       FcPatternEqualSubset(l->pattern, r->pattern, render_props);
+}
+
+static uint32_t *font_slot_for(const font_rec *key)
+{
+	uint32_t mask = font_slots_cap - 1;
+	uint32_t i = (uint32_t)(font_hash(key) >> 32) & mask;
+	while (font_slots[i] && !font_eql(font_rec_for(font_slots[i]), key)) {
+		i = (i + 1) & mask;
+	}
+	return &font_slots[i];
+}
+
+static void font_slots_grow(void)
+{
+	uint32_t *old = font_slots;
+	uint32_t old_cap = font_slots_cap;
+	font_slots_cap = font_slots_cap ? font_slots_cap * 2 : 256;
+	font_slots = calloc(font_slots_cap, sizeof(uint32_t));
+	for (uint32_t i = 0; i < old_cap; i++) {
+		if (old[i]) {
+			*font_slot_for(font_rec_for(old[i])) = old[i];
+		}
+	}
+	free(old);
+}
+
+// Everything layout and drawing want from the pattern, read once.
+// The pattern isnt referenced yet, see gp_font_intern.
+static void font_init(gp_font_t *font, FcPattern *pattern)
+{
+	*font = (gp_font_t){
+	        .pattern = pattern,
+	        .file = "",
+	        .scale_x = 1.0,
+	        .scale_y = 1.0,
+	};
+	FcPatternGetString(pattern, FC_FILE, 0, (FcChar8 **)&font->file);
+	FcPatternGetInteger(pattern, FC_INDEX, 0, &font->index);
+	FcPatternGetDouble(pattern, FC_PIXEL_SIZE, 0, &font->size);
+	FcBool scalable;
+	font->scalable = FcPatternGetBool(pattern, FC_SCALABLE, 0, &scalable) ==
+	                         FcResultMatch &&
+	                 scalable;
+
+	// typically provided by 10-scale-bitmap-fonts.conf, maybe
+	// other fonts will have matrix factors as well.
+	FcMatrix *scale_mat;
+	if (FcPatternGetMatrix(pattern, FC_MATRIX, 0, &scale_mat) ==
+	    FcResultMatch) {
+		if (scale_mat->xy != 0.0 || scale_mat->yx != 0.0) {
+			printf("Uh-oh, shear/rotate matrix detected. Rendering probably going wrong.\n");
+		}
+		font->scale_x = scale_mat->xx;
+		font->scale_y = scale_mat->yy;
+	}
+	font->linear = shapes_linearly(pattern);
+}
+
+uint32_t gp_font_intern(FcPattern *pattern)
+{
+	if (!pattern) {
+		return 0;
+	}
+	pthread_once(&render_props_once, render_props_init);
+	font_rec key = {0};
+	font_init(&key.font, pattern);
+	FcPattern *render = FcPatternFilter(pattern, render_props);
+	key.render = FcPatternHash(render);
+	FcPatternDestroy(render);
+	pthread_mutex_lock(&fonts_lock);
+	if ((fonts_len + 1) * 2 > font_slots_cap) {
+		font_slots_grow();
+	}
+	uint32_t *slot = font_slot_for(&key);
+	if (!*slot) {
+		uint32_t id = fonts_len;
+		if (id >= GP_FONT_CHUNK * GP_FONT_CHUNKS) {
+			printf("Woops too many fonts\n");
+			pthread_mutex_unlock(&fonts_lock);
+			return 0;
+		}
+		font_rec **chunk = &font_chunks[id / GP_FONT_CHUNK];
+		if (!*chunk) {
+			*chunk = calloc(GP_FONT_CHUNK, sizeof(font_rec));
+		}
+		// The first pattern of a font stands for all of them.
+		FcPatternReference(pattern);
+		(*chunk)[id % GP_FONT_CHUNK].font = key.font;
+		(*chunk)[id % GP_FONT_CHUNK].render = key.render;
+		fonts_len++;
+		*slot = id;
+	}
+	uint32_t id = *slot;
+	pthread_mutex_unlock(&fonts_lock);
+	return id;
+}
+
+const gp_font_t *gp_font_get(uint32_t id)
+{
+	font_rec *rec = font_rec_for(id);
+	return rec ? &rec->font : NULL;
+}
+
+// New references to the font's shaping objects, created on first use.
+// unscaled is NULL unless the font shapes linearly.
+bool font_hb(uint32_t id, hb_font_t **font, hb_font_t **unscaled)
+{
+	font_rec *rec = font_rec_for(id);
+	if (!rec) {
+		return false;
+	}
+	pthread_mutex_lock(&fonts_lock);
+	if (!rec->hb) {
+		// load font tables (uses internal hb-ot functions)
+		// should use ft to share with cairo pathing
+		hb_blob_t *fileblob = blob_for_file(rec->font.file);
+		hb_face_t *face = hb_face_create(fileblob, rec->font.index);
+		// Set font size during shaping, for appropriate glyph advances.
+		// add subpixel scaling factor on top since hb is integer based.
+		rec->hb = hb_font_create(face);
+		hb_font_set_scale(
+		        rec->hb,
+		        rec->font.size * rec->font.scale_x * GP_SHAPE_SCALE,
+		        rec->font.size * rec->font.scale_y * GP_SHAPE_SCALE);
+		hb_font_make_immutable(rec->hb);
+		if (rec->font.linear) {
+			int upem = hb_face_get_upem(face);
+			rec->unscaled = hb_font_create(face);
+			hb_font_set_scale(rec->unscaled, upem, upem);
+			hb_font_make_immutable(rec->unscaled);
+		}
+		hb_face_destroy(face);
+		hb_blob_destroy(fileblob);
+	}
+	*font = hb_font_reference(rec->hb);
+	*unscaled = rec->unscaled ? hb_font_reference(rec->unscaled) : NULL;
+	pthread_mutex_unlock(&fonts_lock);
+	return true;
+}
+
+// The font options cairo would draw with on cr by itself: the target
+// surface's, overridden by whatever was set on cr.
+cairo_font_options_t *font_options_for(cairo_t *cr)
+{
+	cairo_font_options_t *options = cairo_font_options_create();
+	cairo_font_options_t *cr_options = cairo_font_options_create();
+	cairo_surface_get_font_options(cairo_get_target(cr), options);
+	cairo_get_font_options(cr, cr_options);
+	cairo_font_options_merge(options, cr_options);
+	cairo_font_options_destroy(cr_options);
+	return options;
+}
+
+// Returns a new reference, so gp_trim cant pull the font out from under the
+// caller. options is from font_options_for, NULL for cairo's defaults when
+// only measuring.
+cairo_scaled_font_t *scaled_font_for(uint32_t id,
+                                     const cairo_font_options_t *options)
+{
+	font_rec *rec = font_rec_for(id);
+	if (!rec) {
+		return NULL;
+	}
+	cairo_font_options_t *defaults = NULL;
+	if (!options) {
+		options = defaults = cairo_font_options_create();
+	}
+	pthread_mutex_lock(&fonts_lock);
+	uint32_t k = 0;
+	while (k < GP_FONT_CAIRO && rec->cairo[k] &&
+	       !cairo_font_options_equal(rec->cairo_options[k], options)) {
+		k++;
+	}
+	if (k == GP_FONT_CAIRO || !rec->cairo[k]) {
+		if (k == GP_FONT_CAIRO) {
+			k = rec->cairo_next++ % GP_FONT_CAIRO;
+			cairo_scaled_font_destroy(rec->cairo[k]);
+			cairo_font_options_destroy(rec->cairo_options[k]);
+		}
+		cairo_font_face_t *face =
+		        cairo_ft_font_face_create_for_pattern(rec->font.pattern);
+		double size = rec->font.size;
+		cairo_matrix_t font_mat = {size, 0, 0, size, 0, 0};
+		// Only use the matrix if the font is marked "scalable".
+		if (rec->font.scalable) {
+			font_mat.xx *= rec->font.scale_x;
+			font_mat.yy *= rec->font.scale_y;
+		}
+
+		// must match shaping size, no scaling factor since cairo isnt integer
+		// based. Identity ctm, cairo rescales itself for transformed contexts.
+		cairo_matrix_t ctm;
+		cairo_matrix_init_identity(&ctm);
+		rec->cairo[k] =
+		        cairo_scaled_font_create(face, &font_mat, &ctm, options);
+		rec->cairo_options[k] = cairo_font_options_copy(options);
+		cairo_font_face_destroy(face);
+	}
+	cairo_scaled_font_t *font = cairo_scaled_font_reference(rec->cairo[k]);
+	pthread_mutex_unlock(&fonts_lock);
+	if (defaults) {
+		cairo_font_options_destroy(defaults);
+	}
+	return font;
+}
+
+// Fonts with HarfBuzz or cairo objects open, for gp_memory_stats.
+void fonts_memory(gp_memory_stats_t *stats)
+{
+	pthread_mutex_lock(&fonts_lock);
+	for (uint32_t id = 1; id < fonts_len; id++) {
+		font_rec *rec = font_rec_for(id);
+		stats->faces += rec->hb != NULL;
+		for (uint32_t k = 0; k < GP_FONT_CAIRO; k++) {
+			stats->faces += rec->cairo[k] != NULL;
+		}
+	}
+	stats->tables += sizeof(uint32_t) * font_slots_cap +
+	                 sizeof(font_rec) * GP_FONT_CHUNK *
+	                         ((fonts_len + GP_FONT_CHUNK - 1) / GP_FONT_CHUNK);
+	pthread_mutex_unlock(&fonts_lock);
+}
+
+// Drop the HarfBuzz and cairo objects, whoever still uses one holds their
+// own reference. Records stay, runs refer to them.
+void fonts_trim(void)
+{
+	pthread_mutex_lock(&fonts_lock);
+	for (uint32_t id = 1; id < fonts_len; id++) {
+		font_rec *rec = font_rec_for(id);
+		hb_font_destroy(rec->hb);
+		hb_font_destroy(rec->unscaled);
+		for (uint32_t k = 0; k < GP_FONT_CAIRO && rec->cairo[k]; k++) {
+			cairo_scaled_font_destroy(rec->cairo[k]);
+			cairo_font_options_destroy(rec->cairo_options[k]);
+			rec->cairo[k] = NULL;
+		}
+		rec->hb = rec->unscaled = NULL;
+	}
+	pthread_mutex_unlock(&fonts_lock);
+}
@@ -0,0 +1,312 @@
+#include <cairo/cairo.h>
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "gp.h"
+
+// Stages of gp_analyze, from gp.c.
+bool analyze_runs(gp_runes_t runes, FcFontSet *fs, FcFontSet *fs_color,
+                  uint32_t *vstr, gp_run_t *runs, uint32_t *len);
+void shape_runs(gp_runes_t vrunes, const char *lang, gp_run_t *runs,
+                uint32_t len);
+
+// Same limit as gp_analyze.
+#define GP_PIPELINE_MAX_RUNES 4095
+
+// Bounded MPMC queue (Vyukov). Each cell's seq says whose turn it is: equal
+// to the position when free for the producer at pos, pos + 1 once filled.
+typedef struct queue_cell {
+	atomic_size_t seq;
+	void *data;
+} queue_cell;
+
+typedef struct gp_queue {
+	queue_cell *cells;
+	size_t mask;
+	_Alignas(64) atomic_size_t head; // next push
+	_Alignas(64) atomic_size_t tail; // next pop
+	_Alignas(64) atomic_bool closed;
+} gp_queue;
+
+static void queue_init(gp_queue *q, size_t cap)
+{
+	size_t n = 2;
+	while (n < cap) {
+		n *= 2;
+	}
+	q->cells = malloc(sizeof(queue_cell) * n);
+	for (size_t i = 0; i < n; i++) {
+		atomic_init(&q->cells[i].seq, i);
+	}
+	q->mask = n - 1;
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	atomic_init(&q->closed, false);
+}
+
+static bool queue_try_push(gp_queue *q, void *data)
+{
+	size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+	queue_cell *c;
+	for (;;) {
+		c = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(
+			            &q->head, &pos, pos + 1, memory_order_relaxed,
+			            memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false; // full
+		} else {
+			pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+		}
+	}
+	c->data = data;
+	atomic_store_explicit(&c->seq, pos + 1, memory_order_release);
+	return true;
+}
+
+static bool queue_try_pop(gp_queue *q, void **data)
+{
+	size_t pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	queue_cell *c;
+	for (;;) {
+		c = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(
+			            &q->tail, &pos, pos + 1, memory_order_relaxed,
+			            memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false; // empty
+		} else {
+			pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+		}
+	}
+	*data = c->data;
+	atomic_store_explicit(&c->seq, pos + q->mask + 1, memory_order_release);
+	return true;
+}
+
+// Spin briefly, then yield, then sleep so idle stages dont burn a core.
+static void backoff(uint32_t *spins)
+{
+	(*spins)++;
+	if (*spins < 64) {
+		return;
+	} else if (*spins < 128) {
+		sched_yield();
+	} else {
+		struct timespec ts = {0, 50 * 1000};
+		nanosleep(&ts, NULL);
+	}
+}
+
+// Blocks while the queue is full, that is the backpressure.
+static void queue_push(gp_queue *q, void *data)
+{
+	uint32_t spins = 0;
+	while (!queue_try_push(q, data)) {
+		backoff(&spins);
+	}
+}
+
+// Returns false once the queue is closed and drained.
+static bool queue_pop(gp_queue *q, void **data)
+{
+	uint32_t spins = 0;
+	for (;;) {
+		if (queue_try_pop(q, data)) {
+			return true;
+		}
+		// closed is set after the last push, so one more try sees it.
+		if (atomic_load(&q->closed)) {
+			return queue_try_pop(q, data);
+		}
+		backoff(&spins);
+	}
+}
+
+typedef struct gp_stage {
+	gp_pipeline_t *p;
+	enum gp_pipeline_stage stage;
+	gp_queue in;
+	atomic_uint active; // workers still running
+	pthread_t *threads;
+	uint32_t threads_len;
+} gp_stage;
+
+struct gp_pipeline {
+	gp_pipeline_opts_t opts;
+	gp_stage stages[GP_STAGE_COUNT];
+	uint32_t stages_len; // GP_STAGE_RASTER is optional
+};
+
+static void stage_decode(gp_pipeline_t *p, gp_paragraph_t *para)
+{
+	(void)p;
+	// A rune over the limit tells longer paragraphs apart, those fail
+	// rather than being cut.
+	uint32_t cap = para->utf8_len < GP_PIPELINE_MAX_RUNES
+	                       ? para->utf8_len
+	                       : GP_PIPELINE_MAX_RUNES + 1;
+	para->runes.data = malloc(sizeof(uint32_t) * (cap + 1));
+	gp_utf8_to_runes(para->utf8, para->utf8_len, cap, para->runes.data,
+	                 &para->runes.len);
+	if (para->runes.len > GP_PIPELINE_MAX_RUNES) {
+		para->runes.len = 0;
+		para->ok = false;
+	}
+}
+
+static void stage_analyze(gp_pipeline_t *p, gp_paragraph_t *para)
+{
+	if (!para->ok || para->runes.len == 0) {
+		return; // too long, or empty which isnt a failure.
+	}
+	para->visual = malloc(sizeof(uint32_t) * para->runes.len);
+	para->runs = malloc(sizeof(gp_run_t) * (para->runes.len + 1));
+	para->ok = analyze_runs(para->runes, p->opts.fs, p->opts.fs_color,
+	                        para->visual, para->runs, &para->runs_len);
+	if (!para->ok) {
+		para->runs_len = 0;
+	}
+}
+
+static void stage_shape(gp_pipeline_t *p, gp_paragraph_t *para)
+{
+	gp_runes_t vrunes = {para->visual, para->runes.len};
+	shape_runs(vrunes, p->opts.lang, para->runs, para->runs_len);
+}
+
+static void stage_raster(gp_pipeline_t *p, gp_paragraph_t *para)
+{
+	(void)p;
+	double width, ascent, descent;
+	gp_measure(para->runs, para->runs_len, &width, &ascent, &descent);
+	int w = (int)ceil(width), h = (int)ceil(ascent + descent);
+	para->surface = cairo_image_surface_create(
+	        CAIRO_FORMAT_ARGB32, w > 0 ? w : 1, h > 0 ? h : 1);
+	cairo_t *cr = cairo_create(para->surface);
+	gp_draw_cairo(cr, para->runs, para->runs_len, 0.0, ascent);
+	cairo_destroy(cr);
+	cairo_surface_flush(para->surface);
+}
+
+static void (*const stage_fns[GP_STAGE_COUNT])(gp_pipeline_t *,
+                                               gp_paragraph_t *) = {
+        [GP_STAGE_DECODE] = stage_decode,
+        [GP_STAGE_ANALYZE] = stage_analyze,
+        [GP_STAGE_SHAPE] = stage_shape,
+        [GP_STAGE_RASTER] = stage_raster,
+};
+
+static void *stage_worker(void *arg)
+{
+	gp_stage *s = arg;
+	gp_pipeline_t *p = s->p;
+	bool last = s->stage + 1 == p->stages_len;
+	void *data;
+	while (queue_pop(&s->in, &data)) {
+		gp_paragraph_t *para = data;
+		// Failed paragraphs still flow through to be handed back.
+		if (para->ok || s->stage <= GP_STAGE_ANALYZE) {
+			stage_fns[s->stage](p, para);
+		}
+		if (last) {
+			p->opts.done(para, p->opts.user);
+		} else {
+			queue_push(&p->stages[s->stage + 1].in, para);
+		}
+	}
+	// The last worker out closes the next stage.
+	if (atomic_fetch_sub(&s->active, 1) == 1 && !last) {
+		atomic_store(&p->stages[s->stage + 1].in.closed, true);
+	}
+	return NULL;
+}
+
+gp_pipeline_t *gp_pipeline_create(const gp_pipeline_opts_t *opts)
+{
+	if (!opts->done) {
+		return NULL;
+	}
+	gp_pipeline_t *p = calloc(1, sizeof(gp_pipeline_t));
+	p->opts = *opts;
+	p->stages_len = opts->raster ? GP_STAGE_COUNT : GP_STAGE_RASTER;
+	size_t cap = opts->queue_cap ? opts->queue_cap : 64;
+	for (uint32_t i = 0; i < p->stages_len; i++) {
+		gp_stage *s = &p->stages[i];
+		s->p = p;
+		s->stage = i;
+		queue_init(&s->in, cap);
+		uint32_t n = opts->threads[i] ? opts->threads[i] : 1;
+		s->threads = malloc(sizeof(pthread_t) * n);
+		atomic_init(&s->active, n);
+	}
+	// Start workers once every queue exists.
+	for (uint32_t i = 0; i < p->stages_len; i++) {
+		gp_stage *s = &p->stages[i];
+		uint32_t n = atomic_load(&s->active);
+		for (; s->threads_len < n; s->threads_len++) {
+			if (pthread_create(&s->threads[s->threads_len], NULL,
+			                   stage_worker, s) != 0) {
+				break;
+			}
+		}
+		atomic_fetch_sub(&s->active, n - s->threads_len);
+	}
+	return p;
+}
+
+void gp_pipeline_push(gp_pipeline_t *p, uint64_t id, const char *utf8,
+                      uint32_t len)
+{
+	gp_paragraph_t *para = calloc(1, sizeof(gp_paragraph_t));
+	para->id = id;
+	para->utf8 = utf8;
+	para->utf8_len = len;
+	para->ok = true;
+	queue_push(&p->stages[GP_STAGE_DECODE].in, para);
+}
+
+void gp_pipeline_finish(gp_pipeline_t *p)
+{
+	atomic_store(&p->stages[GP_STAGE_DECODE].in.closed, true);
+	for (uint32_t i = 0; i < p->stages_len; i++) {
+		gp_stage *s = &p->stages[i];
+		for (uint32_t t = 0; t < s->threads_len; t++) {
+			pthread_join(s->threads[t], NULL);
+		}
+		free(s->threads);
+		free(s->in.cells);
+	}
+	free(p);
+}
+
+void gp_paragraph_destroy(gp_paragraph_t *para)
+{
+	gp_run_destroy(para->runs, para->runs_len);
+	free(para->runes.data);
+	free(para->visual);
+	if (para->surface) {
+		cairo_surface_destroy(para->surface);
+	}
+	free(para);
+}
@@ -0,0 +1,160 @@
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "gp.h"
+
+// Longest corpus line analyzed, gp_analyze doesnt take more.
+#define GP_PREWARM_MAX_RUNES 4095
+
+struct gp_prewarm {
+	char *corpus; // lines, '\n' replaced by '\0'
+	char **lines;
+	uint32_t total;
+
+	FcFontSet *fs;
+	FcFontSet *fs_color;
+	char *lang;
+	struct timespec deadline;
+
+	atomic_uint next; // next line to take
+	atomic_uint done;
+	atomic_bool stop;
+
+	pthread_t *threads;
+	uint32_t threads_len;
+};
+
+static bool past(const struct timespec *deadline)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec > deadline->tv_sec ||
+	       (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec);
+}
+
+static void *prewarm_thread(void *arg)
+{
+	gp_prewarm_t *p = arg;
+	uint32_t *runes = malloc(sizeof(uint32_t) * GP_PREWARM_MAX_RUNES);
+	while (!atomic_load(&p->stop) && !past(&p->deadline)) {
+		uint32_t i = atomic_fetch_add(&p->next, 1);
+		if (i >= p->total) {
+			break;
+		}
+		gp_runes_t str = {runes, 0};
+		gp_utf8_to_runes(p->lines[i], strlen(p->lines[i]),
+		                 GP_PREWARM_MAX_RUNES, runes, &str.len);
+		gp_run_t *runs;
+		uint32_t len;
+		// Results are thrown away, we only want the caches filled.
+		if (str.len && gp_analyze(str, p->fs, p->fs_color, p->lang, &runs,
+		                          &len)) {
+			gp_run_destroy(runs, len);
+		}
+		atomic_fetch_add(&p->done, 1);
+	}
+	free(runes);
+	return NULL;
+}
+
+static char *read_file(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		return NULL;
+	}
+	size_t cap = 4096, len = 0, n;
+	char *buf = malloc(cap + 1);
+	while ((n = fread(buf + len, 1, cap - len, f)) > 0) {
+		len += n;
+		if (len == cap) {
+			cap *= 2;
+			buf = realloc(buf, cap + 1);
+		}
+	}
+	fclose(f);
+	buf[len] = '\0';
+	return buf;
+}
+
+gp_prewarm_t *gp_prewarm(const char *corpus_path, FcFontSet *fs,
+                         FcFontSet *fs_color, const char *lang,
+                         uint32_t threads, uint32_t budget_ms)
+{
+	char *corpus = read_file(corpus_path);
+	if (!corpus) {
+		return NULL;
+	}
+	gp_prewarm_t *p = calloc(1, sizeof(gp_prewarm_t));
+	p->corpus = corpus;
+	p->fs = fs;
+	p->fs_color = fs_color;
+	p->lang = lang ? strdup(lang) : NULL;
+
+	uint32_t cap = 0;
+	for (char *line = corpus, *nl; *line; line = nl + 1) {
+		nl = strchr(line, '\n');
+		if (!nl) {
+			nl = line + strlen(line) - 1;
+		} else {
+			*nl = '\0';
+		}
+		if (!*line) {
+			continue;
+		}
+		if (p->total == cap) {
+			cap = cap * 2 + 256;
+			p->lines = realloc(p->lines, sizeof(char *) * cap);
+		}
+		p->lines[p->total++] = line;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &p->deadline);
+	p->deadline.tv_sec += budget_ms / 1000;
+	p->deadline.tv_nsec += (long)(budget_ms % 1000) * 1000000;
+	if (p->deadline.tv_nsec >= 1000000000) {
+		p->deadline.tv_sec++;
+		p->deadline.tv_nsec -= 1000000000;
+	}
+
+	p->threads = malloc(sizeof(pthread_t) * (threads ? threads : 1));
+	for (uint32_t i = 0; i < (threads ? threads : 1); i++) {
+		if (pthread_create(&p->threads[p->threads_len], NULL, prewarm_thread,
+		                   p) == 0) {
+			p->threads_len++;
+		}
+	}
+	return p;
+}
+
+bool gp_prewarm_progress(gp_prewarm_t *p, uint32_t *done, uint32_t *total)
+{
+	*done = atomic_load(&p->done);
+	*total = p->total;
+	return *done < p->total && !atomic_load(&p->stop) && !past(&p->deadline);
+}
+
+uint32_t gp_prewarm_wait(gp_prewarm_t *p, bool cancel)
+{
+	if (cancel) {
+		atomic_store(&p->stop, true);
+	}
+	for (uint32_t i = 0; i < p->threads_len; i++) {
+		pthread_join(p->threads[i], NULL);
+	}
+	uint32_t done = atomic_load(&p->done);
+	free(p->threads);
+	free(p->lines);
+	free(p->corpus);
+	free(p->lang);
+	free(p);
+	return done;
+}
@@ -1,6 +1,14 @@
 #ifndef GP_HEADER_GP_PROPS_H
 #define GP_HEADER_GP_PROPS_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct gp_runes {
+	uint32_t *data;
+	uint32_t len;
+} gp_runes_t;
+
 enum gp_script {
 	GP_SCRIPT_ADLAM = 0x41646c6d,
 	GP_SCRIPT_CAUCASIAN_ALBANIAN = 0x41676862,
@@ -167,7 +175,53 @@ enum gp_width {
 	GP_WIDTH_WIDE,
 };
 
+// Grapheme_Cluster_Break values from UAX #29. Extended_Pictographic runes
+// are all GCB=Other so they get their own value for the emoji rules.
+enum gp_gcb {
+	GP_GCB_OTHER,
+	GP_GCB_CR,
+	GP_GCB_LF,
+	GP_GCB_CONTROL,
+	GP_GCB_EXTEND,
+	GP_GCB_ZWJ,
+	GP_GCB_REGIONAL_INDICATOR,
+	GP_GCB_PREPEND,
+	GP_GCB_SPACINGMARK,
+	GP_GCB_L,
+	GP_GCB_V,
+	GP_GCB_T,
+	GP_GCB_LV,
+	GP_GCB_LVT,
+	GP_GCB_EXTENDED_PICTOGRAPHIC,
+};
+
+// Per-rune properties packed by gp_classify. The low byte holds a script id
+// (see gp_script_from_id), followed by the width and flags for runes
+// itemization treats specially.
+typedef uint16_t gp_props_t;
+#define GP_PROPS_SCRIPT_ID(p) ((uint8_t)((p)&0xFF))
+#define GP_PROPS_WIDTH(p) ((enum gp_width)(((p) >> 8) & 0x7))
+#define GP_PROPS_SPACE 0x0800
+#define GP_PROPS_SELECTOR 0x1000
+#define GP_PROPS_EMOJI 0x2000 // Emoji_Presentation
+
 enum gp_width gp_rune_width(uint32_t rune);
 enum gp_script gp_rune_script(uint32_t rune);
+enum gp_gcb gp_rune_gcb(uint32_t rune);
+enum gp_script gp_script_from_id(uint8_t id);
+
+// Classify every rune up front, props must hold runes.len entries. Scanning
+// the dense props array is much cheaper than calling the per-rune lookups.
+void gp_classify(gp_runes_t runes, gp_props_t *props);
+
+// Length of the longest RGI emoji sequence (keycap, flag, tag, modifier,
+// ZWJ or VS16 sequence) starting at runes.data[at], 0 if none does. Runs a
+// DFA generated from emoji-sequences.txt and emoji-zwj-sequences.txt.
+uint32_t gp_emoji_sequence(gp_runes_t runes, uint32_t at);
+
+// Find extended grapheme cluster boundaries (UAX #29, without the Indic
+// conjunct rule GB9c) in logical order. breaks must hold runes.len entries,
+// breaks[i] is set when a cluster starts at runes.data[i].
+void gp_grapheme_breaks(gp_runes_t runes, bool *breaks);
 
 #endif
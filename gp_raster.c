@@ -0,0 +1,1061 @@
+#include <hb.h>
+#include <fontconfig/fontconfig.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "gp.h"
+
+// Glyphs are rasterized at this many horizontal subpixel offsets.
+#define GP_RASTER_SUBPIXEL_BITS 2
+#define GP_RASTER_SUBPIXELS (1 << GP_RASTER_SUBPIXEL_BITS)
+// Faces kept open for rendering, each with its own glyph cache.
+#define GP_RASTER_FONTS 16
+
+typedef struct raster_glyph {
+	uint32_t glyph;
+	uint8_t subpixel;
+	bool used;
+	int16_t left, top; // bitmap offset from the pen position, y up
+	uint16_t width, height;
+	uint8_t *coverage; // width * height alpha values
+} raster_glyph;
+
+typedef struct raster_font {
+	uint32_t font; // id, 0 for an empty slot
+	FT_Face face;
+	raster_glyph *glyphs; // open addressed, glyphs_cap is a power of 2
+	uint32_t glyphs_cap;
+	uint32_t glyphs_len;
+
+	// Key of the face in the color glyph cache.
+	bool color;
+	char *file;
+	int index;
+	uint32_t size; // 26.6 pixels
+	uint64_t key; // hash of the above
+	double strike_scale; // bitmap strike to pixel size
+} raster_font;
+
+// Everything cached here is shared by the process and guarded by
+// raster_lock, held for a whole gp_draw_image since blits read cache entries
+// other threads could replace.
+static pthread_mutex_t raster_lock = PTHREAD_MUTEX_INITIALIZER;
+static FT_Library ft_library;
+static raster_font raster_fonts[GP_RASTER_FONTS];
+static uint32_t raster_fonts_next;
+
+// Color glyphs (CBDT/sbix bitmaps, COLR layers) are scaled to size once and
+// kept premultiplied, apart from the coverage caches so they outlive the
+// face and are shared by every pattern of the same face and size. Direct
+// mapped, a colliding glyph simply replaces the older one. Also under
+// raster_lock.
+#define GP_COLOR_GLYPHS 1024
+typedef struct color_glyph {
+	uint64_t key;
+	char *file;
+	int index;
+	uint32_t size;
+	uint32_t glyph;
+	int16_t left, top;
+	uint16_t width, height;
+	uint32_t *pixels; // premultiplied ARGB, NULL if the glyph has no color
+} color_glyph;
+static color_glyph color_glyphs[GP_COLOR_GLYPHS];
+
+void raster_font_clear(raster_font *font)
+{
+	for (uint32_t i = 0; i < font->glyphs_cap; i++) {
+		free(font->glyphs[i].coverage);
+	}
+	free(font->glyphs);
+	free(font->file);
+	if (font->face) {
+		FT_Done_Face(font->face);
+	}
+	memset(font, 0, sizeof(*font));
+}
+
+static uint64_t color_font_key(const raster_font *font)
+{
+	// FNV-1a
+	uint64_t h = 0xcbf29ce484222325ull;
+	for (const char *c = font->file; *c; c++) {
+		h = (h ^ (uint8_t)*c) * 0x100000001b3ull;
+	}
+	h = (h ^ (uint64_t)font->index) * 0x100000001b3ull;
+	return (h ^ font->size) * 0x100000001b3ull;
+}
+
+raster_font *raster_font_for(uint32_t id)
+{
+	const gp_font_t *f = gp_font_get(id);
+	if (!f) {
+		return NULL;
+	}
+	for (uint32_t i = 0; i < GP_RASTER_FONTS; i++) {
+		if (raster_fonts[i].font == id) {
+			return &raster_fonts[i];
+		}
+	}
+	if (!ft_library && FT_Init_FreeType(&ft_library)) {
+		printf("Woops failed to init freetype\n");
+		return NULL;
+	}
+
+	FT_Face face;
+	if (FT_New_Face(ft_library, f->file, f->index, &face)) {
+		printf("Woops failed to load %s\n", f->file);
+		return NULL;
+	}
+
+	// Same size as shaping, see shaper_load.
+	double size_x = f->size * f->scale_x, size_y = f->size * f->scale_y;
+	double strike_scale = 1.0;
+	if (FT_Set_Char_Size(face, size_x * 64, size_y * 64, 72, 72) &&
+	    face->num_fixed_sizes > 0) {
+		// Bitmap only, take the smallest strike at least as large and
+		// scale it down, or the largest one.
+		int best = 0;
+		for (int i = 1; i < face->num_fixed_sizes; i++) {
+			FT_Pos ppem = face->available_sizes[i].y_ppem;
+			FT_Pos best_ppem = face->available_sizes[best].y_ppem;
+			if (best_ppem < size_y * 64 ? ppem > best_ppem
+			                            : ppem >= size_y * 64 &&
+			                                      ppem < best_ppem) {
+				best = i;
+			}
+		}
+		FT_Select_Size(face, best);
+		strike_scale = size_y * 64 / face->available_sizes[best].y_ppem;
+	}
+
+	raster_font *font = &raster_fonts[raster_fonts_next++ % GP_RASTER_FONTS];
+	raster_font_clear(font);
+	font->font = id;
+	font->face = face;
+	font->glyphs_cap = 256;
+	font->glyphs = calloc(font->glyphs_cap, sizeof(raster_glyph));
+	font->color = FT_HAS_COLOR(face);
+	font->file = strdup(f->file);
+	font->index = f->index;
+	font->size = size_y * 64;
+	font->key = color_font_key(font);
+	font->strike_scale = strike_scale;
+	return font;
+}
+
+static uint32_t glyph_hash(uint32_t glyph, uint8_t subpixel)
+{
+	return (glyph * GP_RASTER_SUBPIXELS + subpixel) * 2654435761u;
+}
+
+static raster_glyph *glyph_slot(raster_font *font, uint32_t glyph,
+                                uint8_t subpixel)
+{
+	uint32_t mask = font->glyphs_cap - 1;
+	uint32_t i = glyph_hash(glyph, subpixel) & mask;
+	while (font->glyphs[i].used && (font->glyphs[i].glyph != glyph ||
+	                                font->glyphs[i].subpixel != subpixel)) {
+		i = (i + 1) & mask;
+	}
+	return &font->glyphs[i];
+}
+
+static void glyphs_grow(raster_font *font)
+{
+	raster_glyph *old = font->glyphs;
+	uint32_t old_cap = font->glyphs_cap;
+	font->glyphs_cap *= 2;
+	font->glyphs = calloc(font->glyphs_cap, sizeof(raster_glyph));
+	for (uint32_t i = 0; i < old_cap; i++) {
+		if (old[i].used) {
+			*glyph_slot(font, old[i].glyph, old[i].subpixel) = old[i];
+		}
+	}
+	free(old);
+}
+
+// Rasterize or fetch a glyph coverage bitmap at a subpixel offset.
+raster_glyph *raster_glyph_for(raster_font *font, uint32_t glyph,
+                               uint8_t subpixel)
+{
+	raster_glyph *g = glyph_slot(font, glyph, subpixel);
+	if (g->used) {
+		return g;
+	}
+	if ((font->glyphs_len + 1) * 4 > font->glyphs_cap * 3) {
+		glyphs_grow(font);
+		g = glyph_slot(font, glyph, subpixel);
+	}
+
+	*g = (raster_glyph){.glyph = glyph, .subpixel = subpixel, .used = true};
+	font->glyphs_len++;
+
+	// Shaping is unhinted, hinting would move glyphs off their advances.
+	FT_Vector delta = {subpixel * 64 / GP_RASTER_SUBPIXELS, 0};
+	FT_Set_Transform(font->face, NULL, &delta);
+	if (FT_Load_Glyph(font->face, glyph, FT_LOAD_NO_HINTING) ||
+	    FT_Render_Glyph(font->face->glyph, FT_RENDER_MODE_NORMAL)) {
+		return g; // empty, dont retry every draw
+	}
+
+	FT_GlyphSlot slot = font->face->glyph;
+	FT_Bitmap *bm = &slot->bitmap;
+	if (bm->pixel_mode != FT_PIXEL_MODE_GRAY &&
+	    bm->pixel_mode != FT_PIXEL_MODE_MONO) {
+		return g;
+	}
+	g->left = slot->bitmap_left;
+	g->top = slot->bitmap_top;
+	g->width = bm->width;
+	g->height = bm->rows;
+	g->coverage = malloc((size_t)g->width * g->height + 1);
+	for (uint32_t row = 0; row < bm->rows; row++) {
+		uint8_t *src = bm->buffer + (ptrdiff_t)row * bm->pitch;
+		uint8_t *dst = g->coverage + (size_t)row * g->width;
+		if (bm->pixel_mode == FT_PIXEL_MODE_GRAY) {
+			memcpy(dst, src, g->width);
+			continue;
+		}
+		for (uint32_t col = 0; col < bm->width; col++) {
+			dst[col] = (src[col / 8] & (0x80 >> (col % 8))) ? 0xFF : 0;
+		}
+	}
+	return g;
+}
+
+// Box filter premultiplied src down (or nearest up) by scale into dst.
+static void scale_argb(const uint8_t *src, uint32_t sw, uint32_t sh,
+                       int32_t pitch, double scale, uint32_t *dst,
+                       uint32_t dw, uint32_t dh)
+{
+	for (uint32_t dy = 0; dy < dh; dy++) {
+		uint32_t y0 = dy / scale, y1 = (dy + 1) / scale;
+		y1 = y1 > y0 ? (y1 < sh ? y1 : sh) : y0 + 1;
+		for (uint32_t dx = 0; dx < dw; dx++) {
+			uint32_t x0 = dx / scale, x1 = (dx + 1) / scale;
+			x1 = x1 > x0 ? (x1 < sw ? x1 : sw) : x0 + 1;
+			uint32_t sum[4] = {0}, n = 0;
+			for (uint32_t y = y0; y < y1 && y < sh; y++) {
+				const uint8_t *px = src + (ptrdiff_t)y * pitch + x0 * 4;
+				for (uint32_t x = x0; x < x1 && x < sw; x++, px += 4, n++) {
+					for (int c = 0; c < 4; c++) {
+						sum[c] += px[c];
+					}
+				}
+			}
+			uint32_t out = 0;
+			for (int c = 0; c < 4 && n; c++) {
+				out |= ((sum[c] + n / 2) / n) << (c * 8);
+			}
+			dst[(size_t)dy * dw + dx] = out;
+		}
+	}
+}
+
+// Fetch or rasterize the color bitmap of a glyph, pixels is NULL for glyphs
+// of color fonts which are plain outlines.
+color_glyph *color_glyph_for(raster_font *font, uint32_t glyph)
+{
+	uint64_t h = (font->key ^ glyph) * 0x100000001b3ull;
+	color_glyph *g = &color_glyphs[h % GP_COLOR_GLYPHS];
+	if (g->file && g->key == font->key && g->glyph == glyph &&
+	    g->size == font->size && g->index == font->index &&
+	    strcmp(g->file, font->file) == 0) {
+		return g;
+	}
+	free(g->file);
+	free(g->pixels);
+	*g = (color_glyph){
+	        .key = font->key,
+	        .file = strdup(font->file),
+	        .index = font->index,
+	        .size = font->size,
+	        .glyph = glyph,
+	};
+
+	FT_Set_Transform(font->face, NULL, NULL);
+	if (FT_Load_Glyph(font->face, glyph, FT_LOAD_COLOR) ||
+	    FT_Render_Glyph(font->face->glyph, FT_RENDER_MODE_NORMAL)) {
+		return g;
+	}
+	FT_GlyphSlot slot = font->face->glyph;
+	FT_Bitmap *bm = &slot->bitmap;
+	if (bm->pixel_mode != FT_PIXEL_MODE_BGRA || !bm->width || !bm->rows) {
+		return g;
+	}
+	// BGRA bytes are already premultiplied ARGB words on little endian.
+	double scale = font->strike_scale;
+	g->width = bm->width * scale + 0.5;
+	g->height = bm->rows * scale + 0.5;
+	g->width = g->width ? g->width : 1;
+	g->height = g->height ? g->height : 1;
+	g->left = slot->bitmap_left * scale + (slot->bitmap_left < 0 ? -0.5 : 0.5);
+	g->top = slot->bitmap_top * scale + (slot->bitmap_top < 0 ? -0.5 : 0.5);
+	g->pixels = malloc(sizeof(uint32_t) * g->width * g->height);
+	scale_argb(bm->buffer, bm->width, bm->rows, bm->pitch, scale, g->pixels,
+	           g->width, g->height);
+	return g;
+}
+
+// Glyph cache sizes for gp_memory_stats.
+void raster_memory(gp_memory_stats_t *stats)
+{
+	pthread_mutex_lock(&raster_lock);
+	for (uint32_t i = 0; i < GP_RASTER_FONTS; i++) {
+		raster_font *font = &raster_fonts[i];
+		if (!font->face) {
+			continue;
+		}
+		stats->faces++;
+		stats->tables += sizeof(raster_glyph) * font->glyphs_cap;
+		for (uint32_t j = 0; j < font->glyphs_cap; j++) {
+			if (font->glyphs[j].coverage) {
+				stats->glyphs += (size_t)font->glyphs[j].width *
+				                 font->glyphs[j].height;
+			}
+		}
+	}
+	for (uint32_t i = 0; i < GP_COLOR_GLYPHS; i++) {
+		if (color_glyphs[i].pixels) {
+			stats->glyphs += sizeof(uint32_t) * color_glyphs[i].width *
+			                 color_glyphs[i].height;
+		}
+	}
+	pthread_mutex_unlock(&raster_lock);
+}
+
+void raster_trim(enum gp_trim_level level)
+{
+	pthread_mutex_lock(&raster_lock);
+	for (uint32_t i = 0; i < GP_COLOR_GLYPHS; i++) {
+		free(color_glyphs[i].file);
+		free(color_glyphs[i].pixels);
+		memset(&color_glyphs[i], 0, sizeof(color_glyph));
+	}
+	for (uint32_t i = 0; i < GP_RASTER_FONTS; i++) {
+		raster_font *font = &raster_fonts[i];
+		if (!font->face) {
+			continue;
+		}
+		if (level >= GP_TRIM_MEDIUM) {
+			raster_font_clear(font);
+			continue;
+		}
+		for (uint32_t j = 0; j < font->glyphs_cap; j++) {
+			free(font->glyphs[j].coverage);
+		}
+		free(font->glyphs);
+		font->glyphs_cap = 256;
+		font->glyphs_len = 0;
+		font->glyphs = calloc(font->glyphs_cap, sizeof(raster_glyph));
+	}
+	pthread_mutex_unlock(&raster_lock);
+}
+
+// Exact x / 255 for x <= 255 * 255.
+static inline uint32_t div255(uint32_t x)
+{
+	x += 128;
+	return (x + (x >> 8)) >> 8;
+}
+
+#ifdef __SSE2__
+static inline __m128i div255_epi16(__m128i x)
+{
+	x = _mm_add_epi16(x, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+#endif
+
+// dst = alpha * cov + dst * (1 - alpha * cov)
+void blend_a8(uint8_t *dst, const uint8_t *cov, uint32_t len, uint8_t alpha)
+{
+	uint32_t i = 0;
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	__m128i a = _mm_set1_epi16(alpha);
+	__m128i full = _mm_set1_epi16(255);
+	for (; i + 8 <= len; i += 8) {
+		__m128i c = _mm_unpacklo_epi8(
+		        _mm_loadl_epi64((const __m128i *)(cov + i)), zero);
+		__m128i d = _mm_unpacklo_epi8(
+		        _mm_loadl_epi64((const __m128i *)(dst + i)), zero);
+		__m128i s = div255_epi16(_mm_mullo_epi16(c, a));
+		d = _mm_add_epi16(
+		        s, div255_epi16(_mm_mullo_epi16(d, _mm_sub_epi16(full, s))));
+		_mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(d, zero));
+	}
+#endif
+	for (; i < len; i++) {
+		uint32_t s = div255(cov[i] * alpha);
+		dst[i] = s + div255(dst[i] * (255 - s));
+	}
+}
+
+// Premultiplied color, dst = color * cov + dst * (1 - color.a * cov)
+void blend_argb32(uint32_t *dst, const uint8_t *cov, uint32_t len,
+                  uint32_t color)
+{
+	uint32_t i = 0;
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	__m128i full = _mm_set1_epi16(255);
+	__m128i col = _mm_unpacklo_epi8(_mm_set1_epi32(color), zero);
+	for (; i + 4 <= len; i += 4) {
+		uint32_t c4;
+		memcpy(&c4, cov + i, 4);
+		if (c4 == 0) {
+			continue;
+		}
+		// Spread each coverage byte over the 4 channels of its pixel.
+		__m128i c = _mm_cvtsi32_si128(c4);
+		c = _mm_unpacklo_epi8(c, c);
+		c = _mm_unpacklo_epi16(c, c);
+		__m128i c_lo = _mm_unpacklo_epi8(c, zero);
+		__m128i c_hi = _mm_unpackhi_epi8(c, zero);
+
+		__m128i px = _mm_loadu_si128((const __m128i *)(dst + i));
+		__m128i d_lo = _mm_unpacklo_epi8(px, zero);
+		__m128i d_hi = _mm_unpackhi_epi8(px, zero);
+
+		__m128i s_lo = div255_epi16(_mm_mullo_epi16(col, c_lo));
+		__m128i s_hi = div255_epi16(_mm_mullo_epi16(col, c_hi));
+		__m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, 0xFF),
+		                                   0xFF);
+		__m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, 0xFF),
+		                                   0xFF);
+		d_lo = _mm_add_epi16(s_lo,
+		                     div255_epi16(_mm_mullo_epi16(
+		                             d_lo, _mm_sub_epi16(full, a_lo))));
+		d_hi = _mm_add_epi16(s_hi,
+		                     div255_epi16(_mm_mullo_epi16(
+		                             d_hi, _mm_sub_epi16(full, a_hi))));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(d_lo, d_hi));
+	}
+#endif
+	uint32_t ca = color >> 24;
+	for (; i < len; i++) {
+		if (cov[i] == 0) {
+			continue;
+		}
+		uint32_t sa = div255(ca * cov[i]);
+		uint32_t d = dst[i], out = 0;
+		for (int shift = 0; shift < 32; shift += 8) {
+			uint32_t s = div255(((color >> shift) & 0xFF) * cov[i]);
+			out |= (s + div255(((d >> shift) & 0xFF) * (255 - sa))) << shift;
+		}
+		dst[i] = out;
+	}
+}
+
+// Premultiplied src over dst, faded by opacity.
+static void blend_over_argb32(uint32_t *dst, const uint32_t *src, uint32_t len,
+                              uint8_t opacity)
+{
+	uint32_t i = 0;
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	__m128i full = _mm_set1_epi16(255);
+	__m128i op = _mm_set1_epi16(opacity);
+	for (; i + 4 <= len; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(s, zero)) == 0xFFFF) {
+			continue;
+		}
+		__m128i s_lo = _mm_unpacklo_epi8(s, zero);
+		__m128i s_hi = _mm_unpackhi_epi8(s, zero);
+		if (opacity != 255) {
+			s_lo = div255_epi16(_mm_mullo_epi16(s_lo, op));
+			s_hi = div255_epi16(_mm_mullo_epi16(s_hi, op));
+		}
+		__m128i px = _mm_loadu_si128((const __m128i *)(dst + i));
+		__m128i d_lo = _mm_unpacklo_epi8(px, zero);
+		__m128i d_hi = _mm_unpackhi_epi8(px, zero);
+		__m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, 0xFF),
+		                                   0xFF);
+		__m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, 0xFF),
+		                                   0xFF);
+		d_lo = _mm_add_epi16(s_lo,
+		                     div255_epi16(_mm_mullo_epi16(
+		                             d_lo, _mm_sub_epi16(full, a_lo))));
+		d_hi = _mm_add_epi16(s_hi,
+		                     div255_epi16(_mm_mullo_epi16(
+		                             d_hi, _mm_sub_epi16(full, a_hi))));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(d_lo, d_hi));
+	}
+#endif
+	for (; i < len; i++) {
+		if (src[i] == 0) {
+			continue;
+		}
+		uint32_t sa = div255((src[i] >> 24) * opacity);
+		uint32_t d = dst[i], out = 0;
+		for (int shift = 0; shift < 32; shift += 8) {
+			uint32_t s = div255(((src[i] >> shift) & 0xFF) * opacity);
+			out |= (s + div255(((d >> shift) & 0xFF) * (255 - sa))) << shift;
+		}
+		dst[i] = out;
+	}
+}
+
+// Blit a cached color glyph. A8 images only get its alpha.
+void draw_color_glyph(gp_image_t *img, color_glyph *g, int32_t pen_x,
+                      int32_t pen_y, uint8_t opacity)
+{
+	int32_t x0 = pen_x + g->left, y0 = pen_y - g->top;
+	int32_t col0 = x0 < 0 ? -x0 : 0;
+	int32_t row0 = y0 < 0 ? -y0 : 0;
+	int32_t cols = g->width, rows = g->height;
+	if (x0 + cols > (int32_t)img->width) {
+		cols = (int32_t)img->width - x0;
+	}
+	if (y0 + rows > (int32_t)img->height) {
+		rows = (int32_t)img->height - y0;
+	}
+	if (col0 >= cols || row0 >= rows) {
+		return;
+	}
+
+	for (int32_t row = row0; row < rows; row++) {
+		const uint32_t *src = g->pixels + (size_t)row * g->width + col0;
+		uint8_t *line = img->data + (size_t)(y0 + row) * img->stride;
+		if (img->format != GP_IMAGE_A8) {
+			blend_over_argb32((uint32_t *)line + x0 + col0, src,
+			                  cols - col0, opacity);
+			continue;
+		}
+		uint8_t *dst = line + x0 + col0;
+		for (int32_t col = 0; col < cols - col0; col++) {
+			uint32_t sa = div255((src[col] >> 24) * opacity);
+			dst[col] = sa + div255(dst[col] * (255 - sa));
+		}
+	}
+}
+
+void draw_glyph(gp_image_t *img, raster_glyph *g, int32_t pen_x,
+                int32_t pen_y, uint32_t color)
+{
+	int32_t x0 = pen_x + g->left, y0 = pen_y - g->top;
+	int32_t col0 = x0 < 0 ? -x0 : 0;
+	int32_t row0 = y0 < 0 ? -y0 : 0;
+	int32_t cols = g->width, rows = g->height;
+	if (x0 + cols > (int32_t)img->width) {
+		cols = (int32_t)img->width - x0;
+	}
+	if (y0 + rows > (int32_t)img->height) {
+		rows = (int32_t)img->height - y0;
+	}
+	if (col0 >= cols || row0 >= rows) {
+		return;
+	}
+
+	for (int32_t row = row0; row < rows; row++) {
+		const uint8_t *cov = g->coverage + (size_t)row * g->width + col0;
+		uint8_t *line = img->data + (size_t)(y0 + row) * img->stride;
+		if (img->format == GP_IMAGE_A8) {
+			blend_a8(line + x0 + col0, cov, cols - col0, color >> 24);
+		} else {
+			blend_argb32((uint32_t *)line + x0 + col0, cov, cols - col0,
+			             color);
+		}
+	}
+}
+
+void gp_draw_image(gp_image_t *img, gp_run_t *runs, uint32_t len, double x,
+                   double y, uint32_t color)
+{
+	pthread_mutex_lock(&raster_lock);
+	for (uint32_t i = 0; i < len; i++) {
+		raster_font *font = raster_font_for(runs[i].font);
+		uint32_t glen;
+		hb_glyph_position_t *glyph_pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
+		hb_glyph_info_t *glyph_info =
+		        hb_buffer_get_glyph_infos(runs[i].glyphs, NULL);
+		for (uint32_t g = 0; g < glen; g++) {
+			double gx = x + glyph_pos[g].x_offset / (double)GP_SHAPE_SCALE;
+			double gy = y + glyph_pos[g].y_offset / (double)GP_SHAPE_SCALE;
+			x += glyph_pos[g].x_advance / (double)GP_SHAPE_SCALE;
+			y += glyph_pos[g].y_advance / (double)GP_SHAPE_SCALE;
+			if (!font) {
+				continue;
+			}
+			int32_t pen_y = (int32_t)(gy + (gy < 0 ? -0.5 : 0.5));
+			if (font->color) {
+				color_glyph *cg =
+				        color_glyph_for(font, glyph_info[g].codepoint);
+				if (cg->pixels) {
+					int32_t pen_x = (int32_t)(gx + (gx < 0 ? -0.5 : 0.5));
+					draw_color_glyph(img, cg, pen_x, pen_y, color >> 24);
+					continue;
+				}
+			}
+
+			// Whole pixels go to the blit, the fraction picks the
+			// pre-rendered subpixel variant.
+			double px = gx * GP_RASTER_SUBPIXELS + 0.5;
+			int32_t sub = (int32_t)px;
+			if (px < sub) {
+				sub--;
+			}
+			int32_t pen_x = sub >> GP_RASTER_SUBPIXEL_BITS;
+			uint8_t subpixel = sub & (GP_RASTER_SUBPIXELS - 1);
+
+			raster_glyph *rg =
+			        raster_glyph_for(font, glyph_info[g].codepoint, subpixel);
+			if (rg->coverage) {
+				draw_glyph(img, rg, pen_x, pen_y, color);
+			}
+		}
+	}
+	pthread_mutex_unlock(&raster_lock);
+}
+
+// Tiled rendering. Glyph bitmaps are copied out of the caches above while
+// runs are added, so tiles can be drawn on any thread without touching them.
+#define GP_TILE_SIZE 256
+
+typedef struct tile_bitmap {
+	uint32_t font;
+	uint32_t glyph;
+	uint8_t subpixel; // GP_RASTER_SUBPIXELS for the color bitmap
+	bool color;
+	raster_glyph coverage; // own copy, unless color
+	color_glyph pixels; // own copy, if color
+} tile_bitmap;
+
+typedef struct tile_glyph {
+	uint32_t bitmap;
+	int32_t pen_x, pen_y;
+	uint32_t color;
+} tile_glyph;
+
+struct gp_tiled {
+	uint32_t width, height;
+	enum gp_image_format format;
+	uint32_t background;
+	uint32_t tile;
+
+	tile_bitmap *bitmaps;
+	uint32_t bitmaps_len;
+	uint32_t bitmaps_cap;
+	uint32_t *slots; // bitmap + 1 by font, glyph and subpixel, 0 if empty
+	uint32_t slots_cap;
+
+	tile_glyph *glyphs; // in drawing order
+	uint32_t glyphs_len;
+	uint32_t glyphs_cap;
+};
+
+gp_tiled_t *gp_tiled_create(uint32_t width, uint32_t height,
+                            enum gp_image_format format, uint32_t background,
+                            uint32_t tile)
+{
+	gp_tiled_t *t = calloc(1, sizeof(gp_tiled_t));
+	t->width = width;
+	t->height = height;
+	t->format = format;
+	t->background = background;
+	t->tile = tile ? tile : GP_TILE_SIZE;
+	t->slots_cap = 256;
+	t->slots = calloc(t->slots_cap, sizeof(uint32_t));
+	return t;
+}
+
+void gp_tiled_destroy(gp_tiled_t *t)
+{
+	if (!t) {
+		return;
+	}
+	for (uint32_t i = 0; i < t->bitmaps_len; i++) {
+		free(t->bitmaps[i].coverage.coverage);
+		free(t->bitmaps[i].pixels.pixels);
+	}
+	free(t->bitmaps);
+	free(t->slots);
+	free(t->glyphs);
+	free(t);
+}
+
+static uint32_t *tile_slot(gp_tiled_t *t, uint32_t font, uint32_t glyph,
+                           uint8_t subpixel)
+{
+	uint32_t mask = t->slots_cap - 1;
+	uint32_t i = (glyph_hash(glyph, subpixel) ^ font * 0x9E3779B9u) & mask;
+	while (t->slots[i]) {
+		tile_bitmap *b = &t->bitmaps[t->slots[i] - 1];
+		if (b->font == font && b->glyph == glyph && b->subpixel == subpixel) {
+			break;
+		}
+		i = (i + 1) & mask;
+	}
+	return &t->slots[i];
+}
+
+static void tile_slots_grow(gp_tiled_t *t)
+{
+	free(t->slots);
+	t->slots_cap *= 2;
+	t->slots = calloc(t->slots_cap, sizeof(uint32_t));
+	for (uint32_t i = 0; i < t->bitmaps_len; i++) {
+		tile_bitmap *b = &t->bitmaps[i];
+		*tile_slot(t, b->font, b->glyph, b->subpixel) = i + 1;
+	}
+}
+
+// Copy of a glyph's bitmap, NULL if it has none. A subpixel of
+// GP_RASTER_SUBPIXELS asks for the color bitmap.
+static tile_bitmap *tile_bitmap_for(gp_tiled_t *t, raster_font *font,
+                                    uint32_t glyph, uint8_t subpixel)
+{
+	uint32_t *slot = tile_slot(t, font->font, glyph, subpixel);
+	if (*slot) {
+		tile_bitmap *b = &t->bitmaps[*slot - 1];
+		return b->coverage.coverage || b->pixels.pixels ? b : NULL;
+	}
+	if ((t->bitmaps_len + 1) * 2 > t->slots_cap) {
+		tile_slots_grow(t);
+		slot = tile_slot(t, font->font, glyph, subpixel);
+	}
+	if (t->bitmaps_len == t->bitmaps_cap) {
+		t->bitmaps_cap = t->bitmaps_cap ? t->bitmaps_cap * 2 : 64;
+		t->bitmaps = realloc(t->bitmaps, sizeof(tile_bitmap) * t->bitmaps_cap);
+	}
+	tile_bitmap *b = &t->bitmaps[t->bitmaps_len++];
+	*b = (tile_bitmap){.font = font->font, .glyph = glyph, .subpixel = subpixel};
+	*slot = t->bitmaps_len;
+
+	if (subpixel == GP_RASTER_SUBPIXELS) {
+		color_glyph *cg = color_glyph_for(font, glyph);
+		if (!cg->pixels) {
+			return NULL;
+		}
+		b->color = true;
+		b->pixels = *cg;
+		b->pixels.file = NULL;
+		size_t size = sizeof(uint32_t) * cg->width * cg->height;
+		b->pixels.pixels = malloc(size);
+		memcpy(b->pixels.pixels, cg->pixels, size);
+		return b;
+	}
+	raster_glyph *rg = raster_glyph_for(font, glyph, subpixel);
+	if (!rg->coverage) {
+		return NULL;
+	}
+	b->coverage = *rg;
+	size_t size = (size_t)rg->width * rg->height + 1;
+	b->coverage.coverage = malloc(size);
+	memcpy(b->coverage.coverage, rg->coverage, size);
+	return b;
+}
+
+static void tile_glyph_add(gp_tiled_t *t, tile_bitmap *b, int32_t pen_x,
+                           int32_t pen_y, uint32_t color)
+{
+	if (t->glyphs_len == t->glyphs_cap) {
+		t->glyphs_cap = t->glyphs_cap ? t->glyphs_cap * 2 : 256;
+		t->glyphs = realloc(t->glyphs, sizeof(tile_glyph) * t->glyphs_cap);
+	}
+	t->glyphs[t->glyphs_len++] =
+	        (tile_glyph){b - t->bitmaps, pen_x, pen_y, color};
+}
+
+void gp_tiled_add(gp_tiled_t *t, gp_run_t *runs, uint32_t len, double x,
+                  double y, uint32_t color)
+{
+	pthread_mutex_lock(&raster_lock);
+	for (uint32_t i = 0; i < len; i++) {
+		raster_font *font = raster_font_for(runs[i].font);
+		uint32_t glen;
+		hb_glyph_position_t *glyph_pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
+		hb_glyph_info_t *glyph_info =
+		        hb_buffer_get_glyph_infos(runs[i].glyphs, NULL);
+		for (uint32_t g = 0; g < glen; g++) {
+			double gx = x + glyph_pos[g].x_offset / (double)GP_SHAPE_SCALE;
+			double gy = y + glyph_pos[g].y_offset / (double)GP_SHAPE_SCALE;
+			x += glyph_pos[g].x_advance / (double)GP_SHAPE_SCALE;
+			y += glyph_pos[g].y_advance / (double)GP_SHAPE_SCALE;
+			if (!font) {
+				continue;
+			}
+			// Same positioning as gp_draw_image.
+			int32_t pen_y = (int32_t)(gy + (gy < 0 ? -0.5 : 0.5));
+			if (font->color) {
+				tile_bitmap *b =
+				        tile_bitmap_for(t, font, glyph_info[g].codepoint,
+				                        GP_RASTER_SUBPIXELS);
+				if (b) {
+					int32_t pen_x = (int32_t)(gx + (gx < 0 ? -0.5 : 0.5));
+					tile_glyph_add(t, b, pen_x, pen_y, color);
+					continue;
+				}
+			}
+			double px = gx * GP_RASTER_SUBPIXELS + 0.5;
+			int32_t sub = (int32_t)px;
+			if (px < sub) {
+				sub--;
+			}
+			tile_bitmap *b =
+			        tile_bitmap_for(t, font, glyph_info[g].codepoint,
+			                        sub & (GP_RASTER_SUBPIXELS - 1));
+			if (b) {
+				tile_glyph_add(t, b, sub >> GP_RASTER_SUBPIXEL_BITS, pen_y,
+				               color);
+			}
+		}
+	}
+	pthread_mutex_unlock(&raster_lock);
+}
+
+// One gp_tiled_render. Bands (rows of tiles) are drawn into a ring of
+// band buffers, a band's buffer is only reused once it has been emitted.
+typedef struct tile_render {
+	gp_tiled_t *t;
+	uint32_t tiles_x, tiles_y;
+	uint32_t *bins; // glyphs of tile i are bins[bin_offsets[i]] onwards
+	uint32_t *bin_offsets;
+
+	uint8_t **bands;
+	uint32_t *remaining; // tiles left to draw per band buffer
+	uint32_t window; // band buffers
+	uint32_t stride;
+
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	uint32_t next; // tile to hand out next
+	uint32_t emitted; // bands
+} tile_render;
+
+static void glyph_box(const gp_tiled_t *t, const tile_glyph *g, int32_t *x0,
+                      int32_t *y0, int32_t *x1, int32_t *y1)
+{
+	const tile_bitmap *b = &t->bitmaps[g->bitmap];
+	int16_t left = b->color ? b->pixels.left : b->coverage.left;
+	int16_t top = b->color ? b->pixels.top : b->coverage.top;
+	*x0 = g->pen_x + left;
+	*y0 = g->pen_y - top;
+	*x1 = *x0 + (b->color ? b->pixels.width : b->coverage.width);
+	*y1 = *y0 + (b->color ? b->pixels.height : b->coverage.height);
+}
+
+// Counting sort of glyphs into the tiles they touch, keeping drawing order
+// within each tile.
+static void tile_bin(tile_render *r)
+{
+	gp_tiled_t *t = r->t;
+	uint32_t tiles = r->tiles_x * r->tiles_y;
+	r->bin_offsets = calloc(tiles + 1, sizeof(uint32_t));
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint32_t i = 0; i < t->glyphs_len; i++) {
+			int32_t x0, y0, x1, y1;
+			glyph_box(t, &t->glyphs[i], &x0, &y0, &x1, &y1);
+			x0 = x0 < 0 ? 0 : x0;
+			y0 = y0 < 0 ? 0 : y0;
+			if (x0 >= x1 || y0 >= y1 || x0 >= (int32_t)t->width ||
+			    y0 >= (int32_t)t->height) {
+				continue;
+			}
+			x1 = x1 > (int32_t)t->width ? (int32_t)t->width : x1;
+			y1 = y1 > (int32_t)t->height ? (int32_t)t->height : y1;
+			for (uint32_t ty = y0 / t->tile; ty <= (y1 - 1) / t->tile; ty++) {
+				for (uint32_t tx = x0 / t->tile; tx <= (x1 - 1) / t->tile;
+				     tx++) {
+					uint32_t tile = ty * r->tiles_x + tx;
+					if (pass == 0) {
+						r->bin_offsets[tile + 1]++;
+					} else {
+						r->bins[r->bin_offsets[tile]++] = i;
+					}
+				}
+			}
+		}
+		if (pass == 0) {
+			for (uint32_t i = 0; i < tiles; i++) {
+				r->bin_offsets[i + 1] += r->bin_offsets[i];
+			}
+			r->bins = malloc(sizeof(uint32_t) * (r->bin_offsets[tiles] + 1));
+		}
+	}
+	// The fill pass left each offset at the start of the next tile.
+	memmove(r->bin_offsets + 1, r->bin_offsets, sizeof(uint32_t) * tiles);
+	r->bin_offsets[0] = 0;
+}
+
+static void tile_draw(tile_render *r, uint32_t tile)
+{
+	gp_tiled_t *t = r->t;
+	uint32_t tx = tile % r->tiles_x, ty = tile / r->tiles_x;
+	uint32_t bpp = t->format == GP_IMAGE_A8 ? 1 : 4;
+	int32_t ox = tx * t->tile, oy = ty * t->tile;
+	gp_image_t img = {
+	        .data = r->bands[ty % r->window] + (size_t)ox * bpp,
+	        .width = t->width - ox < t->tile ? t->width - ox : t->tile,
+	        .height = t->height - oy < t->tile ? t->height - oy : t->tile,
+	        .stride = r->stride,
+	        .format = t->format,
+	};
+	for (uint32_t row = 0; row < img.height; row++) {
+		uint8_t *line = img.data + (size_t)row * img.stride;
+		if (t->format == GP_IMAGE_A8) {
+			memset(line, t->background >> 24, img.width);
+			continue;
+		}
+		for (uint32_t col = 0; col < img.width; col++) {
+			((uint32_t *)line)[col] = t->background;
+		}
+	}
+	for (uint32_t i = r->bin_offsets[tile]; i < r->bin_offsets[tile + 1];
+	     i++) {
+		tile_glyph *g = &t->glyphs[r->bins[i]];
+		tile_bitmap *b = &t->bitmaps[g->bitmap];
+		if (b->color) {
+			draw_color_glyph(&img, &b->pixels, g->pen_x - ox, g->pen_y - oy,
+			                 g->color >> 24);
+		} else {
+			draw_glyph(&img, &b->coverage, g->pen_x - ox, g->pen_y - oy,
+			           g->color);
+		}
+	}
+}
+
+// Hand out the next tile if its band has a buffer. Called locked.
+static bool tile_take(tile_render *r, uint32_t *tile)
+{
+	if (r->next == r->tiles_x * r->tiles_y ||
+	    r->next / r->tiles_x >= r->emitted + r->window) {
+		return false;
+	}
+	*tile = r->next++;
+	return true;
+}
+
+// Draw a taken tile and mark it done. Called locked, returns locked.
+static void tile_run(tile_render *r, uint32_t tile)
+{
+	pthread_mutex_unlock(&r->lock);
+	tile_draw(r, tile);
+	pthread_mutex_lock(&r->lock);
+	if (--r->remaining[tile / r->tiles_x % r->window] == 0) {
+		pthread_cond_broadcast(&r->cond);
+	}
+}
+
+static void *tile_thread(void *data)
+{
+	tile_render *r = data;
+	pthread_mutex_lock(&r->lock);
+	while (r->next < r->tiles_x * r->tiles_y) {
+		uint32_t tile;
+		if (tile_take(r, &tile)) {
+			tile_run(r, tile);
+		} else {
+			pthread_cond_wait(&r->cond, &r->lock);
+		}
+	}
+	pthread_mutex_unlock(&r->lock);
+	return NULL;
+}
+
+void gp_tiled_render(gp_tiled_t *t, uint32_t threads, gp_tiled_rows_fn rows,
+                     void *user)
+{
+	if (!t->width || !t->height) {
+		return;
+	}
+	if (!threads) {
+		long n = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = n > 0 ? n : 1;
+	}
+	tile_render r = {
+	        .t = t,
+	        .tiles_x = (t->width + t->tile - 1) / t->tile,
+	        .tiles_y = (t->height + t->tile - 1) / t->tile,
+	        .stride = t->width * (t->format == GP_IMAGE_A8 ? 1 : 4),
+	};
+	if (threads > r.tiles_x * r.tiles_y) {
+		threads = r.tiles_x * r.tiles_y;
+	}
+	tile_bin(&r);
+	// Enough bands to keep every thread busy while the caller emits.
+	r.window = (threads + r.tiles_x - 1) / r.tiles_x + 1;
+	r.window = r.window < r.tiles_y ? r.window : r.tiles_y;
+	r.bands = malloc(sizeof(uint8_t *) * r.window);
+	r.remaining = malloc(sizeof(uint32_t) * r.window);
+	for (uint32_t i = 0; i < r.window; i++) {
+		r.bands[i] = malloc((size_t)r.stride * t->tile);
+		r.remaining[i] = r.tiles_x;
+	}
+	pthread_mutex_init(&r.lock, NULL);
+	pthread_cond_init(&r.cond, NULL);
+
+	// The calling thread draws too, so it never waits on workers that
+	// failed to start.
+	pthread_t *workers = malloc(sizeof(pthread_t) * threads);
+	uint32_t workers_len = 0;
+	for (uint32_t i = 1; i < threads; i++) {
+		if (pthread_create(&workers[workers_len], NULL, tile_thread, &r) ==
+		    0) {
+			workers_len++;
+		}
+	}
+
+	for (uint32_t band = 0; band < r.tiles_y; band++) {
+		uint32_t slot = band % r.window;
+		pthread_mutex_lock(&r.lock);
+		while (r.remaining[slot]) {
+			uint32_t tile;
+			if (tile_take(&r, &tile)) {
+				tile_run(&r, tile);
+			} else {
+				pthread_cond_wait(&r.cond, &r.lock);
+			}
+		}
+		pthread_mutex_unlock(&r.lock);
+
+		uint32_t y = band * t->tile;
+		gp_image_t img = {
+		        .data = r.bands[slot],
+		        .width = t->width,
+		        .height = t->height - y < t->tile ? t->height - y : t->tile,
+		        .stride = r.stride,
+		        .format = t->format,
+		};
+		if (rows) {
+			rows(&img, y, user);
+		}
+
+		pthread_mutex_lock(&r.lock);
+		r.remaining[slot] = r.tiles_x;
+		r.emitted++;
+		pthread_cond_broadcast(&r.cond);
+		pthread_mutex_unlock(&r.lock);
+	}
+
+	for (uint32_t i = 0; i < workers_len; i++) {
+		pthread_join(workers[i], NULL);
+	}
+	free(workers);
+	pthread_cond_destroy(&r.cond);
+	pthread_mutex_destroy(&r.lock);
+	for (uint32_t i = 0; i < r.window; i++) {
+		free(r.bands[i]);
+	}
+	free(r.bands);
+	free(r.remaining);
+	free(r.bins);
+	free(r.bin_offsets);
+}
@@ -0,0 +1,487 @@
+#include <hb.h>
+#include <cairo/cairo.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gp.h"
+
+// From gp_font.c.
+cairo_font_options_t *font_options_for(cairo_t *cr);
+cairo_scaled_font_t *scaled_font_for(uint32_t id,
+                                     const cairo_font_options_t *options);
+
+// Damage boxes are merged into one past this many, merging is quadratic.
+#define GP_RETAINED_MAX_BOXES 512
+// Boxes closer than this are merged, a few rectangles beat many slivers.
+#define GP_RETAINED_MERGE_GAP 4
+
+typedef struct retained_run {
+	uint64_t hash;
+	uint32_t font;
+	uint32_t color;
+	uint32_t glyph; // first in the frame's glyphs
+	uint32_t len;
+	bool matched;
+	bool boxed;
+	double x0, y0, x1, y1; // ink box, once boxed
+} retained_run;
+
+typedef struct retained_frame {
+	retained_run *runs;
+	uint32_t runs_len;
+	uint32_t runs_cap;
+	cairo_glyph_t *glyphs;
+	uint32_t glyphs_len;
+	uint32_t glyphs_cap;
+} retained_frame;
+
+// A glyph of an unmatched run, for the glyph level diff.
+typedef struct glyph_key {
+	uint32_t font;
+	uint32_t color;
+	uint32_t index;
+	int32_t x, y; // 1/64 pixels
+	uint32_t run;
+	uint32_t glyph;
+} glyph_key;
+
+typedef struct box {
+	int32_t x0, y0, x1, y1;
+} box;
+
+struct gp_retained {
+	uint32_t background;
+	bool invalid;
+	retained_frame frames[2];
+	uint32_t next; // frame being added to, the other one is on screen
+
+	// Scratch kept between frames so static ones allocate nothing.
+	uint32_t *table; // old run + 1 by hash, open addressed
+	uint32_t table_cap;
+	glyph_key *keys[2];
+	uint32_t keys_cap[2];
+	box *boxes;
+	uint32_t boxes_cap;
+};
+
+gp_retained_t *gp_retained_create(uint32_t background)
+{
+	gp_retained_t *r = calloc(1, sizeof(gp_retained_t));
+	r->background = background;
+	return r;
+}
+
+void gp_retained_destroy(gp_retained_t *r)
+{
+	for (uint32_t f = 0; f < 2; f++) {
+		free(r->frames[f].runs);
+		free(r->frames[f].glyphs);
+		free(r->keys[f]);
+	}
+	free(r->table);
+	free(r->boxes);
+	free(r);
+}
+
+void gp_retained_invalidate(gp_retained_t *r)
+{
+	r->invalid = true;
+}
+
+static void *grow(void *p, uint32_t *cap, uint32_t need, size_t size)
+{
+	if (need <= *cap) {
+		return p;
+	}
+	*cap = need * 2 + 16;
+	return realloc(p, size * *cap);
+}
+
+static int32_t to_64(double v)
+{
+	return (int32_t)lround(v * 64.0);
+}
+
+void gp_retained_add(gp_retained_t *r, gp_run_t *runs, uint32_t len, double x,
+                     double y, uint32_t color)
+{
+	retained_frame *f = &r->frames[r->next];
+	f->runs = grow(f->runs, &f->runs_cap, f->runs_len + len,
+	               sizeof(retained_run));
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t glen;
+		hb_glyph_info_t *info = hb_buffer_get_glyph_infos(runs[i].glyphs, &glen);
+		hb_glyph_position_t *pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, NULL);
+		f->glyphs = grow(f->glyphs, &f->glyphs_cap, f->glyphs_len + glen,
+		                 sizeof(cairo_glyph_t));
+		retained_run *run = &f->runs[f->runs_len++];
+		*run = (retained_run){
+		        .font = runs[i].font,
+		        .color = color,
+		        .glyph = f->glyphs_len,
+		        .len = glen,
+		};
+		// FNV-1a over what ends up on screen, positions as drawn.
+		uint64_t h = 0xcbf29ce484222325ull;
+		h = (h ^ runs[i].font) * 0x100000001b3ull;
+		h = (h ^ color) * 0x100000001b3ull;
+		for (uint32_t k = 0; k < glen; k++) {
+			cairo_glyph_t *g = &f->glyphs[f->glyphs_len++];
+			g->index = info[k].codepoint;
+			g->x = x + pos[k].x_offset / (double)GP_SHAPE_SCALE;
+			g->y = y + pos[k].y_offset / (double)GP_SHAPE_SCALE;
+			x += pos[k].x_advance / (double)GP_SHAPE_SCALE;
+			y += pos[k].y_advance / (double)GP_SHAPE_SCALE;
+			h = (h ^ g->index) * 0x100000001b3ull;
+			h = (h ^ (uint32_t)to_64(g->x)) * 0x100000001b3ull;
+			h = (h ^ (uint32_t)to_64(g->y)) * 0x100000001b3ull;
+		}
+		run->hash = h;
+	}
+}
+
+// Ink box of glyphs drawn with font, in the space of their positions.
+static void glyphs_box(uint32_t font_id, const cairo_glyph_t *glyphs,
+                       uint32_t len, double *x0, double *y0, double *x1,
+                       double *y1)
+{
+	*x0 = *y0 = *x1 = *y1 = 0.0;
+	cairo_scaled_font_t *font = scaled_font_for(font_id, NULL);
+	if (!font || !len) {
+		if (font) {
+			cairo_scaled_font_destroy(font);
+		}
+		return;
+	}
+	cairo_text_extents_t ext;
+	cairo_scaled_font_glyph_extents(font, glyphs, len, &ext);
+	cairo_scaled_font_destroy(font);
+	// Bearings are relative to the first glyph.
+	*x0 = glyphs[0].x + ext.x_bearing;
+	*y0 = glyphs[0].y + ext.y_bearing;
+	*x1 = *x0 + ext.width;
+	*y1 = *y0 + ext.height;
+}
+
+static void run_box(retained_frame *f, retained_run *run)
+{
+	if (!run->boxed) {
+		glyphs_box(run->font, &f->glyphs[run->glyph], run->len, &run->x0,
+		           &run->y0, &run->x1, &run->y1);
+		run->boxed = true;
+	}
+}
+
+static void add_box(gp_retained_t *r, uint32_t *len, double x0, double y0,
+                    double x1, double y1)
+{
+	if (x1 <= x0 || y1 <= y0) {
+		return;
+	}
+	r->boxes = grow(r->boxes, &r->boxes_cap, *len + 1, sizeof(box));
+	// A pixel more for antialiasing.
+	r->boxes[(*len)++] = (box){floor(x0) - 1, floor(y0) - 1, ceil(x1) + 1,
+	                           ceil(y1) + 1};
+}
+
+static bool run_equal(const retained_frame *fa, const retained_run *a,
+                      const retained_frame *fb, const retained_run *b)
+{
+	return a->hash == b->hash && a->font == b->font && a->color == b->color &&
+	       a->len == b->len &&
+	       memcmp(&fa->glyphs[a->glyph], &fb->glyphs[b->glyph],
+	              sizeof(cairo_glyph_t) * a->len) == 0;
+}
+
+// Pair up runs drawn identically in both frames, matched ones keep their
+// box and need no redraw.
+static void match_runs(gp_retained_t *r, retained_frame *old,
+                       retained_frame *cur)
+{
+	uint32_t cap = 16;
+	while (cap < old->runs_len * 2) {
+		cap *= 2;
+	}
+	if (cap > r->table_cap) {
+		free(r->table);
+		r->table = malloc(sizeof(uint32_t) * cap);
+		r->table_cap = cap;
+	}
+	uint32_t mask = cap - 1;
+	memset(r->table, 0, sizeof(uint32_t) * cap);
+	for (uint32_t i = 0; i < old->runs_len; i++) {
+		uint32_t s = old->runs[i].hash & mask;
+		while (r->table[s]) {
+			s = (s + 1) & mask;
+		}
+		r->table[s] = i + 1;
+	}
+	for (uint32_t i = 0; i < cur->runs_len; i++) {
+		retained_run *run = &cur->runs[i];
+		for (uint32_t s = run->hash & mask; r->table[s]; s = (s + 1) & mask) {
+			retained_run *o = &old->runs[r->table[s] - 1];
+			if (!o->matched && run_equal(old, o, cur, run)) {
+				o->matched = run->matched = true;
+				run->boxed = o->boxed;
+				run->x0 = o->x0;
+				run->y0 = o->y0;
+				run->x1 = o->x1;
+				run->y1 = o->y1;
+				break;
+			}
+		}
+	}
+}
+
+static int key_cmp(const void *l, const void *r)
+{
+	const glyph_key *a = l, *b = r;
+	if (a->font != b->font) {
+		return a->font < b->font ? -1 : 1;
+	}
+	if (a->color != b->color) {
+		return a->color < b->color ? -1 : 1;
+	}
+	if (a->index != b->index) {
+		return a->index < b->index ? -1 : 1;
+	}
+	if (a->y != b->y) {
+		return a->y < b->y ? -1 : 1;
+	}
+	return a->x < b->x ? -1 : a->x > b->x;
+}
+
+// Glyphs of unmatched runs, sorted for the merge in diff_glyphs.
+static uint32_t unmatched_keys(gp_retained_t *r, uint32_t which,
+                               retained_frame *f)
+{
+	uint32_t n = 0;
+	for (uint32_t i = 0; i < f->runs_len; i++) {
+		retained_run *run = &f->runs[i];
+		if (run->matched) {
+			continue;
+		}
+		r->keys[which] = grow(r->keys[which], &r->keys_cap[which],
+		                      n + run->len, sizeof(glyph_key));
+		for (uint32_t k = 0; k < run->len; k++) {
+			cairo_glyph_t *g = &f->glyphs[run->glyph + k];
+			r->keys[which][n++] = (glyph_key){
+			        .font = run->font,
+			        .color = run->color,
+			        .index = g->index,
+			        .x = to_64(g->x),
+			        .y = to_64(g->y),
+			        .run = i,
+			        .glyph = run->glyph + k,
+			};
+		}
+	}
+	qsort(r->keys[which], n, sizeof(glyph_key), key_cmp);
+	return n;
+}
+
+static void glyph_damage(gp_retained_t *r, uint32_t *boxes,
+                         retained_frame *f, const glyph_key *k)
+{
+	double x0, y0, x1, y1;
+	glyphs_box(k->font, &f->glyphs[k->glyph], 1, &x0, &y0, &x1, &y1);
+	add_box(r, boxes, x0, y0, x1, y1);
+}
+
+// Within changed runs only glyphs that moved, appeared or went away are
+// damaged, so a clock redraws the digit that ticked.
+static void diff_glyphs(gp_retained_t *r, uint32_t *boxes,
+                        retained_frame *old, retained_frame *cur)
+{
+	uint32_t on = unmatched_keys(r, 0, old);
+	uint32_t cn = unmatched_keys(r, 1, cur);
+	const glyph_key *ok = r->keys[0], *ck = r->keys[1];
+	uint32_t i = 0, j = 0;
+	while (i < on || j < cn) {
+		int c = i == on ? 1 : j == cn ? -1 : key_cmp(&ok[i], &ck[j]);
+		if (c < 0) {
+			glyph_damage(r, boxes, old, &ok[i++]);
+		} else if (c > 0) {
+			glyph_damage(r, boxes, cur, &ck[j++]);
+		} else {
+			i++;
+			j++;
+		}
+	}
+}
+
+static bool box_near(const box *a, const box *b)
+{
+	return a->x0 <= b->x1 + GP_RETAINED_MERGE_GAP &&
+	       b->x0 <= a->x1 + GP_RETAINED_MERGE_GAP &&
+	       a->y0 <= b->y1 + GP_RETAINED_MERGE_GAP &&
+	       b->y0 <= a->y1 + GP_RETAINED_MERGE_GAP;
+}
+
+static box box_union(const box *a, const box *b)
+{
+	return (box){a->x0 < b->x0 ? a->x0 : b->x0, a->y0 < b->y0 ? a->y0 : b->y0,
+	             a->x1 > b->x1 ? a->x1 : b->x1, a->y1 > b->y1 ? a->y1 : b->y1};
+}
+
+static int64_t box_area(const box *b)
+{
+	return (int64_t)(b->x1 - b->x0) * (b->y1 - b->y0);
+}
+
+// Merge overlapping and nearby boxes, then the cheapest pairs until at most
+// cap are left.
+static uint32_t merge_boxes(box *boxes, uint32_t n, uint32_t cap)
+{
+	if (n > GP_RETAINED_MAX_BOXES) {
+		for (uint32_t i = 1; i < n; i++) {
+			boxes[0] = box_union(&boxes[0], &boxes[i]);
+		}
+		n = 1;
+	}
+	for (bool merged = true; merged;) {
+		merged = false;
+		for (uint32_t i = 0; i < n; i++) {
+			for (uint32_t j = i + 1; j < n; j++) {
+				if (box_near(&boxes[i], &boxes[j])) {
+					boxes[i] = box_union(&boxes[i], &boxes[j]);
+					boxes[j--] = boxes[--n];
+					merged = true;
+				}
+			}
+		}
+	}
+	while (n > cap) {
+		uint32_t bi = 0, bj = 1;
+		int64_t best = INT64_MAX;
+		for (uint32_t i = 0; i < n; i++) {
+			for (uint32_t j = i + 1; j < n; j++) {
+				box u = box_union(&boxes[i], &boxes[j]);
+				int64_t growth = box_area(&u) - box_area(&boxes[i]) -
+				                 box_area(&boxes[j]);
+				if (growth < best) {
+					best = growth;
+					bi = i;
+					bj = j;
+				}
+			}
+		}
+		boxes[bi] = box_union(&boxes[bi], &boxes[bj]);
+		boxes[bj] = boxes[--n];
+	}
+	return n;
+}
+
+static bool run_hits(const retained_run *run, const box *boxes, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		if (run->x0 < boxes[i].x1 && run->x1 > boxes[i].x0 &&
+		    run->y0 < boxes[i].y1 && run->y1 > boxes[i].y0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void set_color(cairo_t *cr, uint32_t color)
+{
+	// Premultiplied 0xAARRGGBB, cairo wants it straight.
+	double a = (color >> 24) / 255.0;
+	double r = ((color >> 16) & 0xFF) / 255.0;
+	double g = ((color >> 8) & 0xFF) / 255.0;
+	double b = (color & 0xFF) / 255.0;
+	if (a > 0.0) {
+		r /= a;
+		g /= a;
+		b /= a;
+	}
+	cairo_set_source_rgba(cr, r, g, b, a);
+}
+
+// Clear the damage to the background and draw every run touching it,
+// clipped so untouched pixels stay as they are.
+static void redraw(gp_retained_t *r, cairo_t *cr, retained_frame *cur,
+                   const box *boxes, uint32_t n)
+{
+	cairo_save(cr);
+	cairo_new_path(cr);
+	for (uint32_t i = 0; i < n; i++) {
+		cairo_rectangle(cr, boxes[i].x0, boxes[i].y0,
+		                boxes[i].x1 - boxes[i].x0, boxes[i].y1 - boxes[i].y0);
+	}
+	cairo_clip(cr);
+	cairo_set_operator(cr, CAIRO_OPERATOR_SOURCE);
+	set_color(cr, r->background);
+	cairo_paint(cr);
+	cairo_set_operator(cr, CAIRO_OPERATOR_OVER);
+	cairo_font_options_t *options = font_options_for(cr);
+	for (uint32_t i = 0; i < cur->runs_len; i++) {
+		retained_run *run = &cur->runs[i];
+		run_box(cur, run);
+		if (!run->len || !run_hits(run, boxes, n)) {
+			continue;
+		}
+		cairo_scaled_font_t *font = scaled_font_for(run->font, options);
+		if (!font) {
+			continue;
+		}
+		cairo_set_scaled_font(cr, font);
+		cairo_scaled_font_destroy(font);
+		set_color(cr, run->color);
+		cairo_show_glyphs(cr, &cur->glyphs[run->glyph], run->len);
+	}
+	cairo_font_options_destroy(options);
+	cairo_restore(cr);
+}
+
+uint32_t gp_retained_draw(gp_retained_t *r, cairo_t *cr, gp_rect_t *damage,
+                          uint32_t cap)
+{
+	retained_frame *cur = &r->frames[r->next];
+	retained_frame *old = &r->frames[r->next ^ 1];
+	uint32_t n = 0;
+	if (r->invalid) {
+		for (uint32_t i = 0; i < old->runs_len; i++) {
+			run_box(old, &old->runs[i]);
+			add_box(r, &n, old->runs[i].x0, old->runs[i].y0,
+			        old->runs[i].x1, old->runs[i].y1);
+		}
+		for (uint32_t i = 0; i < cur->runs_len; i++) {
+			run_box(cur, &cur->runs[i]);
+			add_box(r, &n, cur->runs[i].x0, cur->runs[i].y0,
+			        cur->runs[i].x1, cur->runs[i].y1);
+		}
+		r->invalid = false;
+	} else {
+		match_runs(r, old, cur);
+		diff_glyphs(r, &n, old, cur);
+	}
+
+	n = merge_boxes(r->boxes, n, cap ? cap : 1);
+	if (n) {
+		redraw(r, cr, cur, r->boxes, n);
+	}
+	// With cap 0 the caller doesn't want damage reported.
+	if (n > cap) {
+		n = cap;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		damage[i] = (gp_rect_t){r->boxes[i].x0, r->boxes[i].y0,
+		                        r->boxes[i].x1 - r->boxes[i].x0,
+		                        r->boxes[i].y1 - r->boxes[i].y0};
+	}
+
+	// This frame is on screen now, start the next one.
+	for (uint32_t i = 0; i < cur->runs_len; i++) {
+		cur->runs[i].matched = false;
+	}
+	old->runs_len = old->glyphs_len = 0;
+	r->next ^= 1;
+	return n;
+}
@@ -0,0 +1,388 @@
+#include <hb.h>
+#include <fontconfig/fontconfig.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_MODULE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gp.h"
+
+// From gp_raster.c.
+void blend_a8(uint8_t *dst, const uint8_t *cov, uint32_t len, uint8_t alpha);
+void blend_argb32(uint32_t *dst, const uint8_t *cov, uint32_t len,
+                  uint32_t color);
+
+// FT_RENDER_MODE_SDF and the sdf/bsdf renderers came with 2.11.
+#define GP_SDF_SUPPORTED                                                    \
+	(FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11))
+
+#define GP_SDF_DEFAULT_SIZE 48
+#define GP_SDF_DEFAULT_SPREAD 6
+// Atlas rows are this wide, it grows downwards up to GP_SDF_MAX_HEIGHT and
+// then starts over.
+#define GP_SDF_WIDTH 1024
+#define GP_SDF_MAX_HEIGHT 4096
+#define GP_SDF_GUTTER 1 // between entries so filtering doesnt bleed
+
+typedef struct sdf_face {
+	char *file;
+	int index;
+	FT_Face face;
+} sdf_face;
+
+typedef struct sdf_entry {
+	uint64_t key; // face + 1 << 32 | glyph, 0 for an empty slot
+	uint16_t x, y; // in the atlas
+	uint16_t width, height; // 0 for glyphs without outline
+	int16_t left, top; // field offset from the origin at ref_size, y up
+} sdf_entry;
+
+typedef struct sdf_shelf {
+	uint32_t y;
+	uint32_t height;
+	uint32_t x; // next free column
+} sdf_shelf;
+
+struct gp_sdf_atlas {
+	uint32_t ref_size;
+	uint32_t spread;
+	FT_Library library;
+
+	sdf_face *faces;
+	uint32_t faces_len;
+
+	sdf_entry *entries; // open addressed, entries_cap is a power of 2
+	uint32_t entries_cap;
+	uint32_t entries_len;
+
+	uint8_t *data; // GP_SDF_WIDTH wide, 128 is the outline
+	uint32_t height;
+	sdf_shelf *shelves;
+	uint32_t shelves_len;
+	uint32_t bottom; // first row below the last shelf
+
+	uint8_t *cov; // a row of coverage while drawing
+	uint32_t cov_cap;
+};
+
+gp_sdf_atlas_t *gp_sdf_atlas_create(uint32_t ref_size, uint32_t spread)
+{
+#if GP_SDF_SUPPORTED
+	gp_sdf_atlas_t *a = calloc(1, sizeof(gp_sdf_atlas_t));
+	a->ref_size = ref_size ? ref_size : GP_SDF_DEFAULT_SIZE;
+	// FreeType takes 2 to 32.
+	a->spread = spread ? spread : GP_SDF_DEFAULT_SPREAD;
+	a->spread = a->spread < 2 ? 2 : a->spread > 32 ? 32 : a->spread;
+	if (FT_Init_FreeType(&a->library)) {
+		printf("Woops failed to init freetype\n");
+		free(a);
+		return NULL;
+	}
+	FT_Int spread_prop = a->spread;
+	FT_Property_Set(a->library, "sdf", "spread", &spread_prop);
+	FT_Property_Set(a->library, "bsdf", "spread", &spread_prop);
+	a->entries_cap = 256;
+	a->entries = calloc(a->entries_cap, sizeof(sdf_entry));
+	a->height = 256;
+	a->data = calloc(GP_SDF_WIDTH, a->height);
+	return a;
+#else
+	(void)ref_size;
+	(void)spread;
+	printf("Woops FreeType is too old for SDF rendering\n");
+	return NULL;
+#endif
+}
+
+void gp_sdf_atlas_destroy(gp_sdf_atlas_t *a)
+{
+	if (!a) {
+		return;
+	}
+	for (uint32_t i = 0; i < a->faces_len; i++) {
+		free(a->faces[i].file);
+		if (a->faces[i].face) {
+			FT_Done_Face(a->faces[i].face);
+		}
+	}
+	free(a->faces);
+	FT_Done_FreeType(a->library);
+	free(a->entries);
+	free(a->data);
+	free(a->shelves);
+	free(a->cov);
+	free(a);
+}
+
+// Index of the face of font in the atlas, every size of a face shares it.
+static uint32_t sdf_face_for(gp_sdf_atlas_t *a, const gp_font_t *font)
+{
+	for (uint32_t i = 0; i < a->faces_len; i++) {
+		if (a->faces[i].index == font->index &&
+		    strcmp(a->faces[i].file, font->file) == 0) {
+			return i;
+		}
+	}
+	a->faces = realloc(a->faces, sizeof(sdf_face) * (a->faces_len + 1));
+	sdf_face *f = &a->faces[a->faces_len];
+	*f = (sdf_face){strdup(font->file), font->index, NULL};
+	if (FT_New_Face(a->library, font->file, font->index, &f->face) ||
+	    FT_Set_Pixel_Sizes(f->face, 0, a->ref_size)) {
+		printf("Woops failed to load %s\n", font->file);
+		if (f->face) {
+			FT_Done_Face(f->face);
+		}
+		f->face = NULL; // remembered so it isnt retried every glyph
+	}
+	return a->faces_len++;
+}
+
+static sdf_entry *entry_slot(gp_sdf_atlas_t *a, uint64_t key)
+{
+	uint32_t mask = a->entries_cap - 1;
+	uint32_t i = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+	while (a->entries[i].key && a->entries[i].key != key) {
+		i = (i + 1) & mask;
+	}
+	return &a->entries[i];
+}
+
+static void entries_grow(gp_sdf_atlas_t *a)
+{
+	sdf_entry *old = a->entries;
+	uint32_t old_cap = a->entries_cap;
+	a->entries_cap *= 2;
+	a->entries = calloc(a->entries_cap, sizeof(sdf_entry));
+	for (uint32_t i = 0; i < old_cap; i++) {
+		if (old[i].key) {
+			*entry_slot(a, old[i].key) = old[i];
+		}
+	}
+	free(old);
+}
+
+// Forget every field, when the atlas is full.
+static void atlas_reset(gp_sdf_atlas_t *a)
+{
+	memset(a->entries, 0, sizeof(sdf_entry) * a->entries_cap);
+	a->entries_len = 0;
+	a->shelves_len = 0;
+	a->bottom = 0;
+}
+
+// Find room for a w x h field. Shelves take fields up to a bit taller than
+// the first one they got, labels mostly reuse a few heights.
+static bool atlas_pack(gp_sdf_atlas_t *a, uint32_t w, uint32_t h,
+                       uint32_t *x, uint32_t *y)
+{
+	w += GP_SDF_GUTTER;
+	h += GP_SDF_GUTTER;
+	if (w > GP_SDF_WIDTH || h > GP_SDF_MAX_HEIGHT) {
+		return false;
+	}
+	for (uint32_t i = 0; i < a->shelves_len; i++) {
+		sdf_shelf *s = &a->shelves[i];
+		if (h <= s->height && h * 4 >= s->height * 3 &&
+		    s->x + w <= GP_SDF_WIDTH) {
+			*x = s->x;
+			*y = s->y;
+			s->x += w;
+			return true;
+		}
+	}
+	if (a->bottom + h > GP_SDF_MAX_HEIGHT) {
+		return false;
+	}
+	while (a->bottom + h > a->height) {
+		a->data = realloc(a->data, (size_t)GP_SDF_WIDTH * a->height * 2);
+		memset(a->data + (size_t)GP_SDF_WIDTH * a->height, 0,
+		       (size_t)GP_SDF_WIDTH * a->height);
+		a->height *= 2;
+	}
+	a->shelves = realloc(a->shelves, sizeof(sdf_shelf) * (a->shelves_len + 1));
+	a->shelves[a->shelves_len++] = (sdf_shelf){a->bottom, h, w};
+	*x = 0;
+	*y = a->bottom;
+	a->bottom += h;
+	return true;
+}
+
+#if GP_SDF_SUPPORTED
+// Field of a glyph from its outline. The sdf renderer struggles with
+// overlapping contours (variable fonts), the bsdf one works from a bitmap
+// and copes, so it is the fallback.
+static FT_Bitmap *render_field(FT_Face face, uint32_t glyph)
+{
+	if (FT_Load_Glyph(face, glyph, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP)) {
+		return NULL;
+	}
+	if (face->glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+		return NULL;
+	}
+	if (FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF)) {
+		if (FT_Load_Glyph(face, glyph,
+		                  FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP) ||
+		    FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL) ||
+		    FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF)) {
+			return NULL;
+		}
+	}
+	FT_Bitmap *bm = &face->glyph->bitmap;
+	return bm->pixel_mode == FT_PIXEL_MODE_GRAY && bm->width && bm->rows
+	               ? bm
+	               : NULL;
+}
+#endif
+
+// Field of glyph, made on first use. NULL if the font has no such outline.
+static sdf_entry *sdf_entry_for(gp_sdf_atlas_t *a, uint32_t face,
+                                uint32_t glyph)
+{
+	uint64_t key = (uint64_t)(face + 1) << 32 | glyph;
+	sdf_entry *e = entry_slot(a, key);
+	if (e->key) {
+		return e->width ? e : NULL;
+	}
+	if ((a->entries_len + 1) * 4 > a->entries_cap * 3) {
+		entries_grow(a);
+		e = entry_slot(a, key);
+	}
+	*e = (sdf_entry){.key = key};
+	a->entries_len++;
+
+#if GP_SDF_SUPPORTED
+	FT_Face ft = a->faces[face].face;
+	FT_Bitmap *bm = ft ? render_field(ft, glyph) : NULL;
+	if (!bm) {
+		return NULL; // empty, dont retry every draw
+	}
+	uint32_t x, y;
+	if (!atlas_pack(a, bm->width, bm->rows, &x, &y)) {
+		// Full, start over. Fields in use this draw are copied out
+		// already.
+		atlas_reset(a);
+		e = entry_slot(a, key);
+		*e = (sdf_entry){.key = key};
+		a->entries_len++;
+		if (!atlas_pack(a, bm->width, bm->rows, &x, &y)) {
+			return NULL;
+		}
+	}
+	e->x = x;
+	e->y = y;
+	e->width = bm->width;
+	e->height = bm->rows;
+	e->left = ft->glyph->bitmap_left;
+	e->top = ft->glyph->bitmap_top;
+	for (uint32_t row = 0; row < bm->rows; row++) {
+		memcpy(a->data + (size_t)(y + row) * GP_SDF_WIDTH + x,
+		       bm->buffer + (ptrdiff_t)row * bm->pitch, bm->width);
+	}
+	return e;
+#else
+	return NULL;
+#endif
+}
+
+// Bilinear field value at (fx, fy) in entry pixels, clamped to its edge
+// which is spread outside the outline anyway.
+static float sample(const gp_sdf_atlas_t *a, const sdf_entry *e, float fx,
+                    float fy)
+{
+	float mx = e->width - 1, my = e->height - 1;
+	fx = fx < 0 ? 0 : fx > mx ? mx : fx;
+	fy = fy < 0 ? 0 : fy > my ? my : fy;
+	int32_t x0 = (int32_t)fx, y0 = (int32_t)fy;
+	int32_t x1 = x0 < mx ? x0 + 1 : x0, y1 = y0 < my ? y0 + 1 : y0;
+	float tx = fx - x0, ty = fy - y0;
+	const uint8_t *r0 = a->data + (size_t)(e->y + y0) * GP_SDF_WIDTH + e->x;
+	const uint8_t *r1 = a->data + (size_t)(e->y + y1) * GP_SDF_WIDTH + e->x;
+	float top = r0[x0] + (r0[x1] - r0[x0]) * tx;
+	float bottom = r1[x0] + (r1[x1] - r1[x0]) * tx;
+	return top + (bottom - top) * ty;
+}
+
+// Shade one field at k device pixels per field pixel, the field's left
+// edge at device bx and its top at by.
+static void draw_field(gp_sdf_atlas_t *a, gp_image_t *img, const sdf_entry *e,
+                       double bx, double by, double k, uint32_t color)
+{
+	int32_t x0 = (int32_t)floor(bx), y0 = (int32_t)floor(by);
+	int32_t x1 = (int32_t)ceil(bx + e->width * k);
+	int32_t y1 = (int32_t)ceil(by + e->height * k);
+	x0 = x0 < 0 ? 0 : x0;
+	y0 = y0 < 0 ? 0 : y0;
+	x1 = x1 > (int32_t)img->width ? (int32_t)img->width : x1;
+	y1 = y1 > (int32_t)img->height ? (int32_t)img->height : y1;
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+	uint32_t cols = x1 - x0;
+	if (cols > a->cov_cap) {
+		a->cov_cap = cols * 2;
+		a->cov = realloc(a->cov, a->cov_cap);
+	}
+	// Field units to device pixels, the outline at 128.
+	float to_px = (float)(a->spread * k / 128.0);
+	float inv_k = (float)(1.0 / k);
+	for (int32_t py = y0; py < y1; py++) {
+		// Field pixel centers are at +0.5.
+		float fy = (float)((py + 0.5 - by) * inv_k - 0.5);
+		bool any = false;
+		for (int32_t px = x0; px < x1; px++) {
+			float fx = (float)((px + 0.5 - bx) * inv_k - 0.5);
+			float d = (sample(a, e, fx, fy) - 128.0f) * to_px + 0.5f;
+			uint8_t c = d <= 0.0f ? 0 : d >= 1.0f ? 255 : (uint8_t)(d * 255.0f);
+			a->cov[px - x0] = c;
+			any |= c != 0;
+		}
+		if (!any) {
+			continue;
+		}
+		uint8_t *line = img->data + (size_t)py * img->stride;
+		if (img->format == GP_IMAGE_A8) {
+			blend_a8(line + x0, a->cov, cols, color >> 24);
+		} else {
+			blend_argb32((uint32_t *)line + x0, a->cov, cols, color);
+		}
+	}
+}
+
+void gp_draw_sdf(gp_sdf_atlas_t *a, gp_image_t *img, gp_run_t *runs,
+                 uint32_t len, double x, double y, double scale, uint32_t color)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		const gp_font_t *font = gp_font_get(runs[i].font);
+		uint32_t face = font ? sdf_face_for(a, font) : 0;
+		// Device pixels per field pixel.
+		double k = font ? font->size * font->scale_y * scale / a->ref_size
+		                : 0.0;
+		uint32_t glen;
+		hb_glyph_position_t *glyph_pos =
+		        hb_buffer_get_glyph_positions(runs[i].glyphs, &glen);
+		hb_glyph_info_t *glyph_info =
+		        hb_buffer_get_glyph_infos(runs[i].glyphs, NULL);
+		for (uint32_t g = 0; g < glen; g++) {
+			double gx =
+			        x + glyph_pos[g].x_offset * scale / GP_SHAPE_SCALE;
+			double gy =
+			        y + glyph_pos[g].y_offset * scale / GP_SHAPE_SCALE;
+			x += glyph_pos[g].x_advance * scale / GP_SHAPE_SCALE;
+			y += glyph_pos[g].y_advance * scale / GP_SHAPE_SCALE;
+			if (!font || k <= 0.0) {
+				continue;
+			}
+			sdf_entry *e = sdf_entry_for(a, face, glyph_info[g].codepoint);
+			if (e) {
+				draw_field(a, img, e, gx + e->left * k, gy - e->top * k, k,
+				           color);
+			}
+		}
+	}
+}
@@ -0,0 +1,444 @@
+#include <hb.h>
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gp.h"
+
+// Serialized analysis results. Everything is addressed by offsets from the
+// start of the data, so it can be mmap'd or placed in shared memory at any
+// address. Glyph ids are read in place so they are in host byte order, and
+// so is the magic, which makes data from a host of the other byte order fail
+// gp_shaped_open. Everything else is little endian.
+//
+//   header     32 bytes, see below
+//   fonts      fonts_len * 16: file (offset in strings), index, size (double).
+//              At most 65536, runs refer to them with 16 bits.
+//   runs       runs_len * 32:  start, end, level, font, script, width,
+//                              first glyph, glyph count, positions offset
+//   glyphs     glyphs_len * 4: glyph ids of all runs, read in place
+//   strings    NUL terminated font file names
+//   positions  per glyph zigzag varints: cluster delta, x_advance delta,
+//              y_advance, x_offset, y_offset. Deltas are from the previous
+//              glyph of the run.
+#define GP_SERIAL_MAGIC 0x52535047 // "GPSR"
+#define GP_SERIAL_VERSION 1
+#define GP_SERIAL_HEADER 32
+#define GP_SERIAL_FONT 16
+#define GP_SERIAL_RUN 32
+#define GP_SERIAL_MAX_FONTS 65536
+
+static void put16(uint8_t *p, uint16_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+	for (int i = 0; i < 4; i++) {
+		p[i] = v >> (8 * i);
+	}
+}
+
+static void put64(uint8_t *p, uint64_t v)
+{
+	for (int i = 0; i < 8; i++) {
+		p[i] = v >> (8 * i);
+	}
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t get64(const uint8_t *p)
+{
+	return get32(p) | (uint64_t)get32(p + 4) << 32;
+}
+
+// Write v as a zigzag varint at buf (if not NULL), returning its length.
+static uint32_t put_varint(uint8_t *buf, int32_t v)
+{
+	uint32_t z = ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+	uint32_t n = 0;
+	do {
+		uint8_t b = z & 0x7F;
+		z >>= 7;
+		if (buf) {
+			buf[n] = b | (z ? 0x80 : 0);
+		}
+		n++;
+	} while (z);
+	return n;
+}
+
+static bool get_varint(const uint8_t **p, const uint8_t *end, int32_t *v)
+{
+	uint32_t z = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (*p >= end) {
+			return false;
+		}
+		uint8_t b = *(*p)++;
+		z |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			*v = (int32_t)(z >> 1) ^ -(int32_t)(z & 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+// Encode positions of a run, only measuring when out is NULL.
+static uint32_t put_positions(uint8_t *out, hb_buffer_t *glyphs)
+{
+	uint32_t glen, n = 0;
+	hb_glyph_info_t *info = hb_buffer_get_glyph_infos(glyphs, &glen);
+	hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(glyphs, NULL);
+	int32_t cluster = 0, x_advance = 0;
+	for (uint32_t g = 0; g < glen; g++) {
+		n += put_varint(out ? out + n : NULL, info[g].cluster - cluster);
+		n += put_varint(out ? out + n : NULL, pos[g].x_advance - x_advance);
+		n += put_varint(out ? out + n : NULL, pos[g].y_advance);
+		n += put_varint(out ? out + n : NULL, pos[g].x_offset);
+		n += put_varint(out ? out + n : NULL, pos[g].y_offset);
+		cluster = info[g].cluster;
+		x_advance = pos[g].x_advance;
+	}
+	return n;
+}
+
+size_t gp_serialize(const gp_run_t *runs, uint32_t len, uint8_t *buf,
+                    size_t cap)
+{
+	uint32_t *fonts = malloc(sizeof(uint32_t) * (len + 1));
+	uint16_t *run_font = malloc(sizeof(uint16_t) * (len + 1));
+	uint32_t fonts_len = 0, glyphs_len = 0, strings_len = 0, pos_len = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t f = 0;
+		while (f < fonts_len && fonts[f] != runs[i].font) {
+			f++;
+		}
+		if (f == GP_SERIAL_MAX_FONTS) {
+			free(fonts);
+			free(run_font);
+			return 0;
+		}
+		if (f == fonts_len) {
+			const gp_font_t *font = gp_font_get(runs[i].font);
+			strings_len += strlen(font ? font->file : "") + 1;
+			fonts[fonts_len++] = runs[i].font;
+		}
+		run_font[i] = f;
+		glyphs_len += hb_buffer_get_length(runs[i].glyphs);
+		pos_len += put_positions(NULL, runs[i].glyphs);
+	}
+
+	size_t fonts_off = GP_SERIAL_HEADER;
+	size_t runs_off = fonts_off + (size_t)fonts_len * GP_SERIAL_FONT;
+	size_t glyphs_off = runs_off + (size_t)len * GP_SERIAL_RUN;
+	size_t strings_off = glyphs_off + (size_t)glyphs_len * 4;
+	size_t pos_off = strings_off + strings_len;
+	size_t size = pos_off + pos_len;
+	if (!buf || cap < size) {
+		free(fonts);
+		free(run_font);
+		return size;
+	}
+
+	memset(buf, 0, size);
+	uint32_t magic = GP_SERIAL_MAGIC;
+	memcpy(buf, &magic, sizeof(magic));
+	put16(buf + 4, GP_SERIAL_VERSION);
+	put16(buf + 6, GP_SERIAL_HEADER);
+	put32(buf + 8, size);
+	put32(buf + 12, fonts_len);
+	put32(buf + 16, len);
+	put32(buf + 20, glyphs_len);
+	put32(buf + 24, strings_off);
+	put32(buf + 28, pos_off);
+
+	uint32_t str = 0;
+	for (uint32_t f = 0; f < fonts_len; f++) {
+		const gp_font_t *font = gp_font_get(fonts[f]);
+		const char *file = font ? font->file : "";
+		int index = font ? font->index : 0;
+		double px = font ? font->size : 0.0;
+		uint64_t px_bits;
+		memcpy(&px_bits, &px, sizeof(px_bits));
+
+		uint8_t *e = buf + fonts_off + (size_t)f * GP_SERIAL_FONT;
+		put32(e, str);
+		put32(e + 4, index);
+		put64(e + 8, px_bits);
+		memcpy(buf + strings_off + str, file, strlen(file) + 1);
+		str += strlen(file) + 1;
+	}
+
+	uint32_t glyph = 0, pos = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t glen;
+		hb_glyph_info_t *info = hb_buffer_get_glyph_infos(runs[i].glyphs, &glen);
+		uint8_t *e = buf + runs_off + (size_t)i * GP_SERIAL_RUN;
+		put32(e, runs[i].start);
+		put32(e + 4, runs[i].end);
+		put16(e + 8, runs[i].level);
+		put16(e + 10, run_font[i]);
+		put32(e + 12, runs[i].script);
+		e[16] = runs[i].width;
+		put32(e + 20, glyph);
+		put32(e + 24, glen);
+		put32(e + 28, pos);
+		for (uint32_t g = 0; g < glen; g++, glyph++) {
+			memcpy(buf + glyphs_off + (size_t)glyph * 4, &info[g].codepoint,
+			       sizeof(uint32_t));
+		}
+		pos += put_positions(buf + pos_off + pos, runs[i].glyphs);
+	}
+
+	free(fonts);
+	free(run_font);
+	return size;
+}
+
+bool gp_shaped_open(gp_shaped_t *shaped, const uint8_t *data, size_t size)
+{
+	uint32_t magic = 0;
+	if (size >= sizeof(magic)) {
+		memcpy(&magic, data, sizeof(magic));
+	}
+	if (size < GP_SERIAL_HEADER || magic != GP_SERIAL_MAGIC ||
+	    get16(data + 4) != GP_SERIAL_VERSION || get32(data + 8) > size) {
+		return false;
+	}
+	uint16_t header = get16(data + 6);
+	uint64_t fonts_len = get32(data + 12);
+	uint64_t runs_len = get32(data + 16);
+	uint64_t glyphs_len = get32(data + 20);
+	uint64_t strings_off = get32(data + 24);
+	uint64_t pos_off = get32(data + 28);
+	size = get32(data + 8);
+	uint64_t glyphs_off =
+	        header + fonts_len * GP_SERIAL_FONT + runs_len * GP_SERIAL_RUN;
+	if (header < GP_SERIAL_HEADER || header % 4 != 0 ||
+	    glyphs_off + glyphs_len * 4 > strings_off || strings_off > pos_off ||
+	    pos_off > size) {
+		return false;
+	}
+	*shaped = (gp_shaped_t){
+	        .data = data,
+	        .size = size,
+	        .runs_len = runs_len,
+	        .fonts_len = fonts_len,
+	};
+	return true;
+}
+
+bool gp_shaped_run(const gp_shaped_t *shaped, uint32_t i,
+                   gp_shaped_run_t *run)
+{
+	const uint8_t *d = shaped->data;
+	uint32_t header = get16(d + 6);
+	uint32_t glyphs_len = get32(d + 20);
+	uint32_t strings_off = get32(d + 24);
+	uint32_t pos_off = get32(d + 28);
+	if (i >= shaped->runs_len) {
+		return false;
+	}
+	const uint8_t *e = d + header + shaped->fonts_len * GP_SERIAL_FONT +
+	                   i * GP_SERIAL_RUN;
+	uint32_t font = get16(e + 10);
+	uint32_t first = get32(e + 20);
+	uint32_t count = get32(e + 24);
+	if (font >= shaped->fonts_len || first > glyphs_len ||
+	    count > glyphs_len - first) {
+		return false;
+	}
+	const uint8_t *f = d + header + font * GP_SERIAL_FONT;
+	uint32_t file = get32(f);
+	if (file >= pos_off - strings_off ||
+	    !memchr(d + strings_off + file, '\0', pos_off - strings_off - file)) {
+		return false;
+	}
+	uint64_t px_bits = get64(f + 8);
+
+	*run = (gp_shaped_run_t){
+	        .start = get32(e),
+	        .end = get32(e + 4),
+	        .level = (int16_t)get16(e + 8),
+	        .script = get32(e + 12),
+	        .width = e[16],
+	        .file = (const char *)d + strings_off + file,
+	        .index = get32(f + 4),
+	        .glyphs_len = count,
+	        .glyphs = (const uint32_t *)(d + header +
+	                                     shaped->fonts_len * GP_SERIAL_FONT +
+	                                     shaped->runs_len * GP_SERIAL_RUN) +
+	                  first,
+	};
+	memcpy(&run->size, &px_bits, sizeof(run->size));
+	return true;
+}
+
+bool gp_shaped_positions(const gp_shaped_t *shaped, uint32_t i,
+                         hb_glyph_position_t *pos, uint32_t *clusters)
+{
+	gp_shaped_run_t run;
+	if (!gp_shaped_run(shaped, i, &run)) {
+		return false;
+	}
+	const uint8_t *d = shaped->data;
+	const uint8_t *e = d + get16(d + 6) + shaped->fonts_len * GP_SERIAL_FONT +
+	                   i * GP_SERIAL_RUN;
+	uint32_t pos_off = get32(d + 28);
+	uint32_t off = get32(e + 28);
+	if (off > shaped->size - pos_off) {
+		return false;
+	}
+	const uint8_t *p = d + pos_off + off, *end = d + shaped->size;
+
+	int32_t cluster = 0, x_advance = 0;
+	for (uint32_t g = 0; g < run.glyphs_len; g++) {
+		int32_t v[5];
+		for (int k = 0; k < 5; k++) {
+			if (!get_varint(&p, end, &v[k])) {
+				return false;
+			}
+		}
+		cluster += v[0];
+		x_advance += v[1];
+		clusters[g] = cluster;
+		pos[g] = (hb_glyph_position_t){
+		        .x_advance = x_advance,
+		        .y_advance = v[2],
+		        .x_offset = v[3],
+		        .y_offset = v[4],
+		};
+	}
+	return true;
+}
+
+static int fontset_find(FcFontSet *fs, const gp_shaped_run_t *run)
+{
+	for (int j = 0; fs && j < fs->nfont; j++) {
+		char *file;
+		int index = 0;
+		double px = 0.0;
+		FcPatternGetInteger(fs->fonts[j], FC_INDEX, 0, &index);
+		FcPatternGetDouble(fs->fonts[j], FC_PIXEL_SIZE, 0, &px);
+		if (FcPatternGetString(fs->fonts[j], FC_FILE, 0, (FcChar8 **)&file) ==
+		            FcResultMatch &&
+		    index == run->index && px == run->size &&
+		    strcmp(file, run->file) == 0) {
+			return j;
+		}
+	}
+	return -1;
+}
+
+// Id of the font of run, from its pattern in fs or fs_color if it is there.
+// Others get a private pattern unless strict, then they are 0. The
+// fontsets stay as they are.
+static uint32_t shaped_font(FcFontSet *fs, FcFontSet *fs_color, bool strict,
+                            const gp_shaped_run_t *run, int32_t *priority)
+{
+	int j = fontset_find(fs, run);
+	if (j >= 0) {
+		*priority = j;
+		return gp_font_intern(fs->fonts[j]);
+	}
+	j = fontset_find(fs_color, run);
+	if (j >= 0) {
+		*priority = j;
+		return gp_font_intern(fs_color->fonts[j]);
+	}
+	if (strict) {
+		return 0;
+	}
+	// Interned by content, so this is the id of any pattern of the font
+	// drawn before with default rendering properties, the format doesnt
+	// keep them.
+	FcPattern *pat = FcPatternCreate();
+	FcPatternAddString(pat, FC_FILE, (const FcChar8 *)run->file);
+	FcPatternAddInteger(pat, FC_INDEX, run->index);
+	FcPatternAddDouble(pat, FC_PIXEL_SIZE, run->size);
+	*priority = fs ? fs->nfont : 0;
+	uint32_t id = gp_font_intern(pat);
+	FcPatternDestroy(pat);
+	return id;
+}
+
+// gp_shaped_to_runs, for gp_analyze_cached too.
+bool shaped_to_runs(const gp_shaped_t *shaped, FcFontSet *fs,
+                    FcFontSet *fs_color, bool strict, gp_run_t **runs_out,
+                    uint32_t *len)
+{
+	gp_run_t *runs = calloc(shaped->runs_len + 1, sizeof(gp_run_t));
+	for (uint32_t i = 0; i < shaped->runs_len; i++) {
+		gp_shaped_run_t run;
+		if (!gp_shaped_run(shaped, i, &run)) {
+			gp_run_destroy(runs, i);
+			return false;
+		}
+		hb_buffer_t *buf = hb_buffer_create();
+		hb_buffer_pre_allocate(buf, run.glyphs_len);
+		for (uint32_t g = 0; g < run.glyphs_len; g++) {
+			hb_buffer_add(buf, run.glyphs[g], 0);
+		}
+		hb_buffer_set_content_type(buf, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+		hb_segment_properties_t props = {
+		        .direction = run.level % 2 ? HB_DIRECTION_RTL
+		                                   : HB_DIRECTION_LTR,
+		        .script = hb_script_from_iso15924_tag((hb_tag_t)run.script),
+		        .language = hb_language_get_default(),
+		};
+		hb_buffer_set_segment_properties(buf, &props);
+		runs[i] = (gp_run_t){
+		        .start = run.start,
+		        .end = run.end,
+		        .level = run.level,
+		        .script = run.script,
+		        .width = run.width,
+		        .glyphs = buf,
+		};
+		runs[i].font = shaped_font(fs, fs_color, strict, &run,
+		                           &runs[i].font_pri);
+		if (!runs[i].font) {
+			gp_run_destroy(runs, i + 1);
+			return false;
+		}
+
+		hb_glyph_info_t *info = hb_buffer_get_glyph_infos(buf, NULL);
+		hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(buf, NULL);
+		uint32_t *clusters = malloc(sizeof(uint32_t) * (run.glyphs_len + 1));
+		bool ok = gp_shaped_positions(shaped, i, pos, clusters);
+		for (uint32_t g = 0; ok && g < run.glyphs_len; g++) {
+			info[g].cluster = clusters[g];
+		}
+		free(clusters);
+		if (!ok) {
+			gp_run_destroy(runs, i + 1);
+			return false;
+		}
+	}
+	*runs_out = runs;
+	*len = shaped->runs_len;
+	return true;
+}
+
+bool gp_shaped_to_runs(const gp_shaped_t *shaped, FcFontSet *fs,
+                       gp_run_t **runs_out, uint32_t *len)
+{
+	return shaped_to_runs(shaped, fs, NULL, false, runs_out, len);
+}
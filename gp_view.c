@@ -0,0 +1,292 @@
+#define _GNU_SOURCE // memrchr
+#include <fontconfig/fontconfig.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gp.h"
+
+// Virtualized layout of huge texts. Lines are found around the viewport
+// with memchr/memrchr and addressed by their byte offset, so nothing ever
+// walks the whole text. Laid out lines are cached until the memory budget
+// forces the ones furthest from the viewport out.
+#define GP_VIEW_BUCKETS 4096
+#define GP_VIEW_MAX_RUNES 4095 // longer lines are cut off
+#define GP_VIEW_DEFAULT_BUDGET (16 << 20)
+
+typedef struct view_line {
+	struct view_line *next; // bucket chain
+	uint64_t start;
+	uint64_t end; // excluding the newline
+	gp_run_t *runs;
+	uint32_t len;
+	double height;
+	double ascent;
+	size_t bytes; // memory held, for the budget
+	uint64_t pinned; // layout generation that returned it
+} view_line;
+
+struct gp_view {
+	const char *text;
+	uint64_t text_len;
+	FcFontSet *fs;
+	FcFontSet *fs_color;
+	char *lang;
+	double line_height;
+	size_t budget;
+
+	view_line *buckets[GP_VIEW_BUCKETS];
+	uint32_t lines_len;
+	size_t bytes;
+	uint64_t generation;
+
+	// Top of the viewport, offset pixels into the line starting at anchor.
+	uint64_t anchor;
+	double offset;
+
+	// Running totals over every line laid out, for estimates.
+	uint64_t seen_lines;
+	uint64_t seen_bytes;
+	double seen_height;
+
+	uint32_t *runes; // decode scratch
+};
+
+static uint32_t line_bucket(uint64_t start)
+{
+	return (start * 0x9E3779B97F4A7C15ull) >> 52; // 12 bits
+}
+
+gp_view_t *gp_view_create(const char *utf8, size_t len, FcFontSet *fs,
+                          FcFontSet *fs_color, const char *lang,
+                          double line_height, size_t budget)
+{
+	gp_view_t *v = calloc(1, sizeof(gp_view_t));
+	v->text = utf8;
+	v->text_len = len;
+	v->fs = fs;
+	v->fs_color = fs_color;
+	v->lang = lang ? strdup(lang) : NULL;
+	v->line_height = line_height;
+	v->budget = budget ? budget : GP_VIEW_DEFAULT_BUDGET;
+	v->runes = malloc(sizeof(uint32_t) * (GP_VIEW_MAX_RUNES + 1));
+	return v;
+}
+
+static void line_free(view_line *l)
+{
+	gp_run_destroy(l->runs, l->len);
+	free(l);
+}
+
+void gp_view_destroy(gp_view_t *v)
+{
+	for (uint32_t b = 0; b < GP_VIEW_BUCKETS; b++) {
+		for (view_line *l = v->buckets[b], *next; l; l = next) {
+			next = l->next;
+			line_free(l);
+		}
+	}
+	free(v->runes);
+	free(v->lang);
+	free(v);
+}
+
+// Start of the line containing byte at.
+static uint64_t line_start(gp_view_t *v, uint64_t at)
+{
+	if (at == 0) {
+		return 0;
+	}
+	const char *nl = memrchr(v->text, '\n', at);
+	return nl ? (uint64_t)(nl - v->text) + 1 : 0;
+}
+
+static view_line *line_lookup(gp_view_t *v, uint64_t start)
+{
+	for (view_line *l = v->buckets[line_bucket(start)]; l; l = l->next) {
+		if (l->start == start) {
+			return l;
+		}
+	}
+	return NULL;
+}
+
+// Laid out line starting at start, from the cache when possible.
+static view_line *line_get(gp_view_t *v, uint64_t start)
+{
+	view_line *l = line_lookup(v, start);
+	if (l) {
+		return l;
+	}
+	const char *s = v->text + start;
+	const char *nl = memchr(s, '\n', v->text_len - start);
+	uint64_t end = nl ? (uint64_t)(nl - v->text) : v->text_len;
+	uint64_t bytes = end - start;
+	if (bytes && s[bytes - 1] == '\r') {
+		bytes--;
+	}
+
+	l = calloc(1, sizeof(view_line));
+	l->start = start;
+	l->end = end;
+	gp_runes_t runes = {v->runes, 0};
+	gp_utf8_to_runes(s, bytes, GP_VIEW_MAX_RUNES, runes.data, &runes.len);
+	l->height = v->line_height;
+	l->bytes = sizeof(view_line);
+	if (runes.len &&
+	    gp_analyze(runes, v->fs, v->fs_color, v->lang, &l->runs, &l->len)) {
+		double width, ascent, descent;
+		gp_measure(l->runs, l->len, &width, &ascent, &descent);
+		if (ascent + descent > l->height) {
+			l->height = ascent + descent;
+		}
+		l->ascent = ascent + (l->height - ascent - descent) / 2;
+		l->bytes += sizeof(gp_run_t) * l->len;
+		for (uint32_t i = 0; i < l->len; i++) {
+			l->bytes += hb_buffer_get_length(l->runs[i].glyphs) *
+			            (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t));
+		}
+	}
+
+	uint32_t b = line_bucket(start);
+	l->next = v->buckets[b];
+	v->buckets[b] = l;
+	v->lines_len++;
+	v->bytes += l->bytes;
+	v->seen_lines++;
+	v->seen_bytes += end - start + 1;
+	v->seen_height += l->height;
+	return l;
+}
+
+static bool line_has_next(gp_view_t *v, const view_line *l)
+{
+	return l->end < v->text_len;
+}
+
+static int line_distance_cmp(const void *a, const void *b)
+{
+	uint64_t da = ((const uint64_t *)a)[0], db = ((const uint64_t *)b)[0];
+	return da < db ? 1 : da > db ? -1 : 0; // furthest first
+}
+
+// Drop lines furthest from the viewport until well under budget. Lines
+// returned by the current layout stay.
+static void evict(gp_view_t *v)
+{
+	if (v->bytes <= v->budget) {
+		return;
+	}
+	// pairs of distance, start
+	uint64_t *order = malloc(sizeof(uint64_t) * 2 * (v->lines_len + 1));
+	uint32_t n = 0;
+	for (uint32_t b = 0; b < GP_VIEW_BUCKETS; b++) {
+		for (view_line *l = v->buckets[b]; l; l = l->next) {
+			if (l->pinned == v->generation) {
+				continue;
+			}
+			order[2 * n] = l->start > v->anchor ? l->start - v->anchor
+			                                    : v->anchor - l->start;
+			order[2 * n + 1] = l->start;
+			n++;
+		}
+	}
+	qsort(order, n, sizeof(uint64_t) * 2, line_distance_cmp);
+	for (uint32_t i = 0; i < n && v->bytes > v->budget / 4 * 3; i++) {
+		view_line **pl = &v->buckets[line_bucket(order[2 * i + 1])];
+		while ((*pl)->start != order[2 * i + 1]) {
+			pl = &(*pl)->next;
+		}
+		view_line *l = *pl;
+		*pl = l->next;
+		v->bytes -= l->bytes;
+		v->lines_len--;
+		line_free(l);
+	}
+	free(order);
+}
+
+void gp_view_scroll_to(gp_view_t *v, double fraction)
+{
+	fraction = fraction < 0.0 ? 0.0 : fraction > 1.0 ? 1.0 : fraction;
+	uint64_t at = (uint64_t)(fraction * v->text_len);
+	v->anchor = line_start(v, at < v->text_len ? at : v->text_len);
+	v->offset = 0.0;
+}
+
+void gp_view_scroll_by(gp_view_t *v, double dy)
+{
+	v->offset += dy;
+	while (v->offset < 0.0 && v->anchor > 0) {
+		v->anchor = line_start(v, v->anchor - 1);
+		v->offset += line_get(v, v->anchor)->height;
+	}
+	if (v->offset < 0.0) {
+		v->offset = 0.0;
+	}
+	for (;;) {
+		view_line *l = line_get(v, v->anchor);
+		if (v->offset < l->height || !line_has_next(v, l)) {
+			break;
+		}
+		v->offset -= l->height;
+		v->anchor = l->end + 1;
+	}
+}
+
+uint32_t gp_view_layout(gp_view_t *v, double height, gp_view_line_t *lines,
+                        uint32_t cap)
+{
+	v->generation++;
+	uint32_t n = 0;
+	double y = -v->offset;
+	view_line *l = line_get(v, v->anchor);
+	for (;;) {
+		if (n < cap) {
+			l->pinned = v->generation;
+			lines[n++] = (gp_view_line_t){
+			        .start = l->start,
+			        .end = l->end,
+			        .runs = l->runs,
+			        .len = l->len,
+			        .y = y,
+			        .height = l->height,
+			        .ascent = l->ascent,
+			};
+		}
+		y += l->height;
+		if (y >= height || !line_has_next(v, l)) {
+			break;
+		}
+		l = line_get(v, l->end + 1);
+	}
+
+	// Prefetch a viewport worth of lines each way, so scrolling finds them
+	// laid out.
+	for (double after = 0.0; after < height && line_has_next(v, l);) {
+		l = line_get(v, l->end + 1);
+		after += l->height;
+	}
+	uint64_t start = v->anchor;
+	for (double before = 0.0; before < height && start > 0;) {
+		start = line_start(v, start - 1);
+		before += line_get(v, start)->height;
+	}
+	evict(v);
+	return n;
+}
+
+void gp_view_scrollbar(gp_view_t *v, double *top, double *total)
+{
+	// Assume unseen text looks like what was laid out so far.
+	double bytes_per_line =
+	        v->seen_lines ? (double)v->seen_bytes / v->seen_lines : 80.0;
+	double line_height =
+	        v->seen_lines ? v->seen_height / v->seen_lines : v->line_height;
+	*total = (v->text_len + 1) / bytes_per_line * line_height;
+	*top = v->anchor / bytes_per_line * line_height + v->offset;
+}
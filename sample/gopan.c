@@ -5,9 +5,16 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+#include <math.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define PREWARM_BUDGET_MS 5000
 
 char *print_font(FcPattern *font)
 {
@@ -40,10 +47,505 @@ void print_fonts(FcFontSet *fs)
 	FcObjectSetDestroy(prop_filter);
 }
 
+// Resident memory split into file backed pages (font mappings shared with
+// other processes) and private anonymous pages.
+void print_rss(const char *when)
+{
+	FILE *f = fopen("/proc/self/status", "r");
+	if (!f) {
+		return;
+	}
+	char line[256];
+	printf("rss %s:", when);
+	while (fgets(line, sizeof(line), f)) {
+		if (strncmp(line, "VmRSS:", 6) == 0 ||
+		    strncmp(line, "RssAnon:", 8) == 0 ||
+		    strncmp(line, "RssFile:", 8) == 0) {
+			line[strcspn(line, "\n")] = '\0';
+			printf(" %s", line);
+		}
+	}
+	printf("\n");
+	fclose(f);
+}
+
+// Warm caches with every line of corpus before rendering, printing progress.
+void prewarm(const char *corpus, FcFontSet *fs, FcFontSet *fs_color)
+{
+	long threads = sysconf(_SC_NPROCESSORS_ONLN);
+	gp_prewarm_t *p = gp_prewarm(corpus, fs, fs_color, "en-US",
+	                             threads > 0 ? threads : 1, PREWARM_BUDGET_MS);
+	if (!p) {
+		printf("Woops failed to read corpus %s\n", corpus);
+		return;
+	}
+	uint32_t done, total;
+	while (gp_prewarm_progress(p, &done, &total)) {
+		printf("\rprewarm: %u/%u lines", done, total);
+		fflush(stdout);
+		usleep(100 * 1000);
+	}
+	done = gp_prewarm_wait(p, false);
+	printf("\rprewarm: %u/%u lines%s\n", done, total,
+	       done == total ? "" : " (out of time)");
+}
+
+// Batch mode, for rendering previews of many strings.
+// gopan --batch [-j threads] [-o dir] [--raw] pattern [input]
+// input (default stdin) has one string per line, or one JSON object per line
+// like {"text": "hello", "font": "serif:weight=200", "size": 14}.
+#define BATCH_PAD 4
+#define BATCH_MAX_RUNES 4095
+
+typedef struct batch_item {
+	char *text;
+	char *font; // fontconfig pattern, NULL for the batch pattern
+	double size; // 0 to keep the pattern's size
+	uint32_t glyphs;
+	uint64_t ns; // time to analyze, render and write
+	bool ok;
+} batch_item;
+
+typedef struct batch_fonts {
+	char *key;
+	FcFontSet *fs;
+	FcFontSet *fs_color;
+} batch_fonts;
+
+typedef struct batch {
+	FcConfig *config;
+	const char *pattern;
+	const char *out_dir;
+	bool raw;
+
+	batch_item *items;
+	uint32_t len;
+	atomic_uint next;
+
+	// Fontsets are loaded once per distinct pattern and shared by all
+	// threads, as are the library's font caches.
+	pthread_mutex_t fonts_lock;
+	batch_fonts *fonts;
+	uint32_t fonts_len;
+	uint32_t fonts_cap;
+} batch;
+
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+static void skip_ws(const char **p)
+{
+	while (**p == ' ' || **p == '\t' || **p == '\r' || **p == '\n') {
+		(*p)++;
+	}
+}
+
+static uint32_t hex4(const char *p)
+{
+	uint32_t v = 0;
+	for (int i = 0; i < 4; i++) {
+		char c = p[i];
+		v = v * 16 + (c >= 'a'   ? c - 'a' + 10
+		              : c >= 'A' ? c - 'A' + 10
+		                         : c - '0');
+	}
+	return v;
+}
+
+static char *put_utf8(char *o, uint32_t c)
+{
+	if (c < 0x80) {
+		*o++ = c;
+	} else if (c < 0x800) {
+		*o++ = 0xC0 | c >> 6;
+		*o++ = 0x80 | (c & 0x3F);
+	} else if (c < 0x10000) {
+		*o++ = 0xE0 | c >> 12;
+		*o++ = 0x80 | ((c >> 6) & 0x3F);
+		*o++ = 0x80 | (c & 0x3F);
+	} else {
+		*o++ = 0xF0 | c >> 18;
+		*o++ = 0x80 | ((c >> 12) & 0x3F);
+		*o++ = 0x80 | ((c >> 6) & 0x3F);
+		*o++ = 0x80 | (c & 0x3F);
+	}
+	return o;
+}
+
+// Parse the JSON string at p, returning it unescaped as utf8.
+static char *json_string(const char **p)
+{
+	if (**p != '"') {
+		return NULL;
+	}
+	const char *c = *p + 1;
+	char *out = malloc(strlen(c) + 1), *o = out;
+	while (*c && *c != '"') {
+		if (*c != '\\') {
+			*o++ = *c++;
+			continue;
+		}
+		c++;
+		switch (*c) {
+		case 'n':
+			*o++ = '\n';
+			break;
+		case 't':
+			*o++ = '\t';
+			break;
+		case 'r':
+			*o++ = '\r';
+			break;
+		case 'b':
+			*o++ = '\b';
+			break;
+		case 'f':
+			*o++ = '\f';
+			break;
+		case 'u': {
+			if (strnlen(c + 1, 4) < 4) {
+				free(out);
+				return NULL;
+			}
+			uint32_t cp = hex4(c + 1);
+			c += 4;
+			if (cp >= 0xD800 && cp < 0xDC00 && c[1] == '\\' && c[2] == 'u' &&
+			    strnlen(c + 3, 4) == 4) {
+				uint32_t lo = hex4(c + 3);
+				if (lo >= 0xDC00 && lo < 0xE000) {
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+					c += 6;
+				}
+			}
+			o = put_utf8(o, cp);
+			break;
+		}
+		case '\0':
+			free(out);
+			return NULL;
+		default: // \" \\ \/
+			*o++ = *c;
+			break;
+		}
+		c++;
+	}
+	if (*c != '"') {
+		free(out);
+		return NULL;
+	}
+	*o = '\0';
+	*p = c + 1;
+	return out;
+}
+
+// Flat objects only, unknown keys are skipped.
+static bool parse_json_item(const char *p, batch_item *it)
+{
+	skip_ws(&p);
+	if (*p++ != '{') {
+		return false;
+	}
+	for (;;) {
+		skip_ws(&p);
+		if (*p == '}') {
+			break;
+		}
+		char *key = json_string(&p);
+		skip_ws(&p);
+		if (!key || *p++ != ':') {
+			free(key);
+			return false;
+		}
+		skip_ws(&p);
+		if (*p == '"') {
+			char *val = json_string(&p);
+			if (!val) {
+				free(key);
+				return false;
+			}
+			if (strcmp(key, "text") == 0) {
+				free(it->text);
+				it->text = val;
+			} else if (strcmp(key, "font") == 0) {
+				free(it->font);
+				it->font = val;
+			} else {
+				free(val);
+			}
+		} else if (strcmp(key, "size") == 0) {
+			char *end;
+			it->size = strtod(p, &end);
+			p = end;
+		} else {
+			p += strcspn(p, ",}");
+		}
+		free(key);
+		skip_ws(&p);
+		if (*p == ',') {
+			p++;
+		} else if (*p != '}') {
+			return false;
+		}
+	}
+	return it->text != NULL;
+}
+
+static char *read_all(FILE *f)
+{
+	size_t cap = 4096, len = 0, n;
+	char *buf = malloc(cap + 1);
+	while ((n = fread(buf + len, 1, cap - len, f)) > 0) {
+		len += n;
+		if (len == cap) {
+			cap *= 2;
+			buf = realloc(buf, cap + 1);
+		}
+	}
+	buf[len] = '\0';
+	return buf;
+}
+
+static batch_fonts *batch_fonts_for(batch *b, const batch_item *it)
+{
+	char key[512];
+	const char *pattern = it->font ? it->font : b->pattern;
+	if (it->size > 0) {
+		snprintf(key, sizeof(key), "%s:size=%g", pattern, it->size);
+	} else {
+		snprintf(key, sizeof(key), "%s", pattern);
+	}
+
+	pthread_mutex_lock(&b->fonts_lock);
+	for (uint32_t i = 0; i < b->fonts_len; i++) {
+		if (strcmp(b->fonts[i].key, key) == 0) {
+			pthread_mutex_unlock(&b->fonts_lock);
+			return &b->fonts[i];
+		}
+	}
+	if (b->fonts_len == b->fonts_cap) {
+		// entries are handed out by pointer, so no realloc.
+		pthread_mutex_unlock(&b->fonts_lock);
+		return NULL;
+	}
+	batch_fonts *f = &b->fonts[b->fonts_len];
+	f->key = strdup(key);
+	f->fs = gp_load_font(b->config, key, false);
+	f->fs_color = gp_load_font(b->config, key, true);
+	b->fonts_len++;
+	pthread_mutex_unlock(&b->fonts_lock);
+	return f;
+}
+
+static void batch_render(batch *b, uint32_t index, uint32_t *runes)
+{
+	batch_item *it = &b->items[index];
+	uint64_t start = now_ns();
+	batch_fonts *fonts = batch_fonts_for(b, it);
+	gp_runes_t str = {runes, 0};
+	gp_utf8_to_runes(it->text, strlen(it->text), BATCH_MAX_RUNES, runes,
+	                 &str.len);
+	gp_run_t *runs;
+	uint32_t len;
+	if (!fonts || !fonts->fs || !str.len ||
+	    !gp_analyze(str, fonts->fs, fonts->fs_color, "en-US", &runs, &len)) {
+		it->ns = now_ns() - start;
+		return;
+	}
+
+	double width, ascent, descent;
+	gp_measure(runs, len, &width, &ascent, &descent);
+	int w = (int)ceil(width) + 2 * BATCH_PAD;
+	int h = (int)ceil(ascent + descent) + 2 * BATCH_PAD;
+	cairo_surface_t *surface =
+	        cairo_image_surface_create(CAIRO_FORMAT_ARGB32, w, h);
+	cairo_t *cr = cairo_create(surface);
+	gp_draw_cairo(cr, runs, len, BATCH_PAD, BATCH_PAD + ascent);
+	cairo_destroy(cr);
+	cairo_surface_flush(surface);
+
+	char path[4096];
+	if (b->raw) {
+		// Premultiplied native endian ARGB32 rows without padding.
+		snprintf(path, sizeof(path), "%s/%06u_%dx%d.argb", b->out_dir, index,
+		         w, h);
+		FILE *f = fopen(path, "wb");
+		uint8_t *data = cairo_image_surface_get_data(surface);
+		int stride = cairo_image_surface_get_stride(surface);
+		for (int y = 0; f && y < h; y++) {
+			fwrite(data + (size_t)y * stride, 4, w, f);
+		}
+		it->ok = f && fclose(f) == 0;
+	} else {
+		snprintf(path, sizeof(path), "%s/%06u.png", b->out_dir, index);
+		it->ok = cairo_surface_write_to_png(surface, path) ==
+		         CAIRO_STATUS_SUCCESS;
+	}
+	cairo_surface_destroy(surface);
+
+	for (uint32_t i = 0; i < len; i++) {
+		it->glyphs += hb_buffer_get_length(runs[i].glyphs);
+	}
+	gp_run_destroy(runs, len);
+	it->ns = now_ns() - start;
+}
+
+static void *batch_thread(void *arg)
+{
+	batch *b = arg;
+	uint32_t *runes = malloc(sizeof(uint32_t) * BATCH_MAX_RUNES);
+	for (uint32_t i; (i = atomic_fetch_add(&b->next, 1)) < b->len;) {
+		batch_render(b, i, runes);
+	}
+	free(runes);
+	return NULL;
+}
+
+static int cmp_u64(const void *l, const void *r)
+{
+	uint64_t a = *(const uint64_t *)l, b = *(const uint64_t *)r;
+	return a < b ? -1 : a > b;
+}
+
+int batch_main(FcConfig *config, int argc, char *argv[])
+{
+	batch b = {.config = config, .out_dir = "."};
+	long threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int a = 1;
+	for (; a < argc && argv[a][0] == '-' && argv[a][1]; a++) {
+		if (strcmp(argv[a], "-j") == 0 && a + 1 < argc) {
+			threads = atol(argv[++a]);
+		} else if (strcmp(argv[a], "-o") == 0 && a + 1 < argc) {
+			b.out_dir = argv[++a];
+		} else if (strcmp(argv[a], "--raw") == 0) {
+			b.raw = true;
+		} else {
+			break;
+		}
+	}
+	if (a >= argc || argc - a > 2) {
+		printf("Call with gopan --batch [-j threads] [-o dir] [--raw] pattern [input]\n");
+		return 1;
+	}
+	b.pattern = argv[a];
+	FILE *in = stdin;
+	if (a + 1 < argc && strcmp(argv[a + 1], "-") != 0) {
+		in = fopen(argv[a + 1], "rb");
+		if (!in) {
+			printf("Woops failed to open %s\n", argv[a + 1]);
+			return 1;
+		}
+	}
+	char *input = read_all(in);
+	if (in != stdin) {
+		fclose(in);
+	}
+
+	uint32_t cap = 0;
+	for (char *line = strtok(input, "\n"); line; line = strtok(NULL, "\n")) {
+		line[strcspn(line, "\r")] = '\0';
+		if (!*line) {
+			continue;
+		}
+		if (b.len == cap) {
+			cap = cap * 2 + 256;
+			b.items = realloc(b.items, sizeof(batch_item) * cap);
+		}
+		batch_item *it = &b.items[b.len];
+		*it = (batch_item){0};
+		if (line[0] == '{') {
+			if (!parse_json_item(line, it)) {
+				printf("Skipping bad line %s\n", line);
+				free(it->text);
+				free(it->font);
+				continue;
+			}
+		} else {
+			it->text = strdup(line);
+		}
+		b.len++;
+	}
+	free(input);
+
+	// At most one fontset per item.
+	b.fonts_cap = b.len;
+	b.fonts = calloc(b.fonts_cap + 1, sizeof(batch_fonts));
+	pthread_mutex_init(&b.fonts_lock, NULL);
+	threads = threads > 0 ? threads : 1;
+	pthread_t *pool = malloc(sizeof(pthread_t) * threads);
+
+	uint64_t start = now_ns();
+	for (long i = 0; i < threads; i++) {
+		pthread_create(&pool[i], NULL, batch_thread, &b);
+	}
+	for (long i = 0; i < threads; i++) {
+		pthread_join(pool[i], NULL);
+	}
+	double secs = (now_ns() - start) / 1e9;
+
+	uint64_t glyphs = 0;
+	uint32_t failed = 0;
+	uint64_t *lat = malloc(sizeof(uint64_t) * (b.len + 1));
+	for (uint32_t i = 0; i < b.len; i++) {
+		glyphs += b.items[i].glyphs;
+		failed += !b.items[i].ok;
+		lat[i] = b.items[i].ns;
+	}
+	qsort(lat, b.len, sizeof(uint64_t), cmp_u64);
+#define PCT(q) (b.len ? lat[(uint32_t)((q) * (b.len - 1))] / 1e6 : 0.0)
+	printf("%u items (%u failed) %lu glyphs in %.3fs on %ld threads: %.0f glyphs/s\n",
+	       b.len, failed, (unsigned long)glyphs, secs, threads,
+	       secs > 0 ? glyphs / secs : 0.0);
+	printf("latency ms: p50 %.3f p90 %.3f p99 %.3f max %.3f\n", PCT(0.5),
+	       PCT(0.9), PCT(0.99), PCT(1.0));
+#undef PCT
+
+	free(lat);
+	free(pool);
+	for (uint32_t i = 0; i < b.fonts_len; i++) {
+		free(b.fonts[i].key);
+		if (b.fonts[i].fs) {
+			FcFontSetDestroy(b.fonts[i].fs);
+		}
+		if (b.fonts[i].fs_color) {
+			FcFontSetDestroy(b.fonts[i].fs_color);
+		}
+	}
+	free(b.fonts);
+	for (uint32_t i = 0; i < b.len; i++) {
+		free(b.items[i].text);
+		free(b.items[i].font);
+	}
+	free(b.items);
+	pthread_mutex_destroy(&b.fonts_lock);
+	return failed ? 1 : 0;
+}
+
 int main(int argc, char *argv[])
 {
+	if (argc > 1 && strcmp(argv[1], "--batch") == 0) {
+		FcConfig *config = FcConfigCreate();
+		if (FcConfigParseAndLoad(config, NULL, FcTrue) != FcTrue) {
+			printf("Failed to load fontconfig\n");
+			return -1;
+		}
+		FcConfigSetCurrent(config);
+		FcConfigBuildFonts(config);
+		return batch_main(config, argc - 1, argv + 1);
+	}
+	const char *corpus = NULL;
+	if (argc == 5 && strcmp(argv[1], "--prewarm") == 0) {
+		corpus = argv[2];
+		argv += 2;
+		argc -= 2;
+	}
 	if (argc != 3) {
 		printf("Invalid arguments.\nCall with Fontconfig pattern and text to render.\nE.g. gopan \"sans-22:weight=10\" \"hello こんにちは 你好 مرحبا שלום ဟယ်လို 👨‍🦳👶👅👀🇹🇼🅱\"\n");
+		printf("Use gopan --prewarm corpus.txt ... to warm caches with each line of corpus.txt first.\n");
+		printf("Use gopan --batch ... to render many strings, see batch_main.\n");
 		exit(1);
 	}
 	FcConfig *config = FcConfigCreate();
@@ -56,6 +558,9 @@ int main(int argc, char *argv[])
 	FcConfigBuildFonts(config);
 	FcFontSet *fs = gp_load_font(config, argv[1], false);
 	FcFontSet *fs_color = gp_load_font(config, argv[1], true);
+	if (corpus) {
+		prewarm(corpus, fs, fs_color);
+	}
 
 	uint32_t lstr[256];
 	gp_runes_t runes = {lstr, 0};
@@ -63,13 +568,21 @@ int main(int argc, char *argv[])
 
 	uint32_t r_len;
 	gp_run_t *runs;
+	print_rss("before analyze");
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
 	gp_analyze(runes, fs, fs_color, "en-US", &runs, &r_len);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	print_rss("after analyze");
+	printf("analyze took %.1fus\n", (t1.tv_sec - t0.tv_sec) * 1e6 +
+	                                     (t1.tv_nsec - t0.tv_nsec) / 1e3);
 
 	printf("runs: %d\n", r_len);
 	uint32_t i = 0;
 	while (i < r_len) {
 		if (runs[i].font) {
-			char *font_str = print_font(runs[i].font);
+			char *font_str =
+			        print_font(gp_font_get(runs[i].font)->pattern);
 			printf("s(0x%04x): %d, e:%d (%s)\n", runes.data[runs[i].start],
 			       runs[i].start, runs[i].end, font_str);
 			FcStrFree((FcChar8 *)font_str);
@@ -83,7 +596,7 @@ int main(int argc, char *argv[])
 	cairo_surface_t *bitmap =
 	        cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 600, 64);
 	cairo_t *cr = cairo_create(bitmap);
-	gp_draw_cairo(cr, runs, r_len);
+	gp_draw_cairo(cr, runs, r_len, 0.0, 48.0);
 
 	if (cairo_surface_write_to_png(bitmap, "out.png") != CAIRO_STATUS_SUCCESS) {
 		printf("Woops failed to write out png");
@@ -0,0 +1,221 @@
+#include <fontconfig/fontconfig.h>
+#include <gp.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "gopand.h"
+
+// Load generator for gopand. Each connection keeps depth requests in flight,
+// cycling through the lines of corpus.
+// gopan_load [-c conns] [-n requests] [-d depth] [--render] socket pattern corpus
+
+typedef struct load {
+	const char *socket;
+	const char *pattern;
+	uint32_t kind;
+	char **lines;
+	uint32_t lines_len;
+	uint32_t per_conn; // requests per connection
+	uint32_t depth;
+
+	uint64_t *lat; // per request, conns * per_conn
+	atomic_uint errors;
+} load;
+
+typedef struct load_conn {
+	load *l;
+	uint32_t index;
+} load_conn;
+
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+static bool send_request(int fd, load *l, uint32_t id)
+{
+	const char *text = l->lines[id % l->lines_len];
+	gopand_request req = {
+	        .magic = GOPAND_MAGIC,
+	        .id = id,
+	        .kind = l->kind,
+	        .pattern_len = strlen(l->pattern),
+	        .text_len = strlen(text),
+	};
+	return gopand_write_full(fd, &req, sizeof(req)) &&
+	       gopand_write_full(fd, l->pattern, req.pattern_len) &&
+	       gopand_write_full(fd, text, req.text_len);
+}
+
+// Map the result like a real client would, checking shaped runs parse.
+static bool check_reply(const gopand_reply *r, int memfd)
+{
+	if (r->status != GOPAND_OK || memfd < 0) {
+		return false;
+	}
+	void *data = mmap(NULL, r->size, PROT_READ, MAP_SHARED, memfd, 0);
+	close(memfd);
+	if (data == MAP_FAILED) {
+		return false;
+	}
+	bool ok = true;
+	if (r->kind == GOPAND_SHAPE) {
+		gp_shaped_t shaped;
+		ok = gp_shaped_open(&shaped, data, r->size);
+	} else {
+		volatile uint8_t last = ((uint8_t *)data)[r->size - 1];
+		(void)last;
+	}
+	munmap(data, r->size);
+	return ok;
+}
+
+static void *load_thread(void *arg)
+{
+	load_conn *lc = arg;
+	load *l = lc->l;
+	uint64_t *lat = l->lat + (size_t)lc->index * l->per_conn;
+	uint64_t *sent = calloc(l->per_conn + 1, sizeof(uint64_t));
+
+	struct sockaddr_un addr = {.sun_family = AF_UNIX};
+	strncpy(addr.sun_path, l->socket, sizeof(addr.sun_path) - 1);
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		perror("Woops failed to connect");
+		atomic_fetch_add(&l->errors, l->per_conn);
+		free(sent);
+		return NULL;
+	}
+
+	uint32_t next = 0, received = 0;
+	while (received < l->per_conn) {
+		while (next < l->per_conn && next - received < l->depth) {
+			sent[next] = now_ns();
+			if (!send_request(fd, l, lc->index * l->per_conn + next)) {
+				break;
+			}
+			next++;
+		}
+		gopand_reply r;
+		int memfd;
+		if (!gopand_recv_reply(fd, &r, &memfd)) {
+			break;
+		}
+		uint32_t i = r.id - lc->index * l->per_conn;
+		if (i < l->per_conn) {
+			lat[i] = now_ns() - sent[i];
+		}
+		if (!check_reply(&r, memfd)) {
+			atomic_fetch_add(&l->errors, 1);
+		}
+		received++;
+	}
+	atomic_fetch_add(&l->errors, l->per_conn - received);
+	close(fd);
+	free(sent);
+	return NULL;
+}
+
+static int cmp_u64(const void *l, const void *r)
+{
+	uint64_t a = *(const uint64_t *)l, b = *(const uint64_t *)r;
+	return a < b ? -1 : a > b;
+}
+
+int main(int argc, char *argv[])
+{
+	load l = {.kind = GOPAND_SHAPE, .depth = 16};
+	uint32_t conns = 4, requests = 10000;
+	int a = 1;
+	for (; a < argc && argv[a][0] == '-'; a++) {
+		if (strcmp(argv[a], "-c") == 0 && a + 1 < argc) {
+			conns = atol(argv[++a]);
+		} else if (strcmp(argv[a], "-n") == 0 && a + 1 < argc) {
+			requests = atol(argv[++a]);
+		} else if (strcmp(argv[a], "-d") == 0 && a + 1 < argc) {
+			l.depth = atol(argv[++a]);
+		} else if (strcmp(argv[a], "--render") == 0) {
+			l.kind = GOPAND_RENDER;
+		} else {
+			break;
+		}
+	}
+	if (argc - a != 3 || !conns || !l.depth) {
+		printf("Call with gopan_load [-c conns] [-n requests] [-d depth] [--render] socket pattern corpus\n");
+		return 1;
+	}
+	l.socket = argv[a];
+	l.pattern = argv[a + 1];
+
+	FILE *f = fopen(argv[a + 2], "rb");
+	if (!f) {
+		printf("Woops failed to open %s\n", argv[a + 2]);
+		return 1;
+	}
+	char line[4096];
+	uint32_t cap = 0;
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (!*line) {
+			continue;
+		}
+		if (l.lines_len == cap) {
+			cap = cap * 2 + 256;
+			l.lines = realloc(l.lines, sizeof(char *) * cap);
+		}
+		l.lines[l.lines_len++] = strdup(line);
+	}
+	fclose(f);
+	if (!l.lines_len) {
+		printf("Empty corpus\n");
+		return 1;
+	}
+
+	l.per_conn = (requests + conns - 1) / conns;
+	size_t total = (size_t)l.per_conn * conns;
+	l.lat = calloc(total + 1, sizeof(uint64_t));
+	pthread_t *threads = malloc(sizeof(pthread_t) * conns);
+	load_conn *lcs = malloc(sizeof(load_conn) * conns);
+
+	uint64_t start = now_ns();
+	for (uint32_t i = 0; i < conns; i++) {
+		lcs[i] = (load_conn){&l, i};
+		pthread_create(&threads[i], NULL, load_thread, &lcs[i]);
+	}
+	for (uint32_t i = 0; i < conns; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	double secs = (now_ns() - start) / 1e9;
+
+	qsort(l.lat, total, sizeof(uint64_t), cmp_u64);
+#define PCT(q) (l.lat[(size_t)((q) * (total - 1))] / 1e6)
+	printf("%zu requests (%u errors) over %u connections, depth %u: %.3fs, %.0f req/s\n",
+	       total, atomic_load(&l.errors), conns, l.depth, secs,
+	       secs > 0 ? total / secs : 0.0);
+	printf("latency ms: p50 %.3f p90 %.3f p99 %.3f max %.3f\n", PCT(0.5),
+	       PCT(0.9), PCT(0.99), PCT(1.0));
+#undef PCT
+
+	for (uint32_t i = 0; i < l.lines_len; i++) {
+		free(l.lines[i]);
+	}
+	free(l.lines);
+	free(l.lat);
+	free(threads);
+	free(lcs);
+	return atomic_load(&l.errors) ? 1 : 0;
+}
@@ -0,0 +1,438 @@
+#define _GNU_SOURCE
+#include <cairo/cairo.h>
+#include <fontconfig/fontconfig.h>
+#include <gp.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <math.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "gopand.h"
+
+// Render daemon. Keeps fontconfig, fontsets and libgp's caches warm across
+// requests from local clients, see gopand.h for the protocol.
+// gopand [-j threads] socket
+#define GOPAND_BATCH 32
+#define GOPAND_FONTS 256
+#define GOPAND_MAX_RUNES 4095
+#define GOPAND_PAD 4
+
+typedef struct conn {
+	int fd;
+	atomic_uint refs; // reader thread and queued jobs
+	pthread_mutex_t write_lock;
+} conn;
+
+typedef struct job {
+	struct job *next;
+	conn *c;
+	uint32_t id;
+	uint32_t kind;
+	char *pattern;
+	char *text;
+} job;
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t ready;
+	job *head;
+	job *tail;
+} queue = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL};
+
+static struct {
+	pthread_mutex_t lock;
+	FcConfig *config;
+	struct {
+		char *pattern;
+		FcFontSet *fs;
+		FcFontSet *fs_color;
+		uint32_t refs; // batches using the sets
+		uint64_t used; // tick of the last lookup, for eviction
+	} sets[GOPAND_FONTS];
+	uint32_t len;
+	uint64_t tick;
+} fonts = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+static void conn_unref(conn *c)
+{
+	if (atomic_fetch_sub(&c->refs, 1) == 1) {
+		close(c->fd);
+		pthread_mutex_destroy(&c->write_lock);
+		free(c);
+	}
+}
+
+static void job_free(job *j)
+{
+	conn_unref(j->c);
+	free(j->pattern);
+	free(j->text);
+	free(j);
+}
+
+// Fontsets stay loaded across requests, that is the point. Past
+// GOPAND_FONTS patterns the least recently used unreferenced one goes.
+// Returns the slot to pass to fonts_release, -1 if the pattern has no
+// fonts or every slot is in use.
+static int fonts_for(const char *pattern, FcFontSet **fs, FcFontSet **fs_color)
+{
+	pthread_mutex_lock(&fonts.lock);
+	uint32_t i = 0;
+	for (; i < fonts.len; i++) {
+		if (strcmp(fonts.sets[i].pattern, pattern) == 0) {
+			break;
+		}
+	}
+	bool found = i < fonts.len;
+	if (!found && fonts.len == GOPAND_FONTS) {
+		uint32_t lru = GOPAND_FONTS;
+		for (uint32_t j = 0; j < fonts.len; j++) {
+			if (!fonts.sets[j].refs &&
+			    (lru == GOPAND_FONTS ||
+			     fonts.sets[j].used < fonts.sets[lru].used)) {
+				lru = j;
+			}
+		}
+		if (lru == GOPAND_FONTS) {
+			pthread_mutex_unlock(&fonts.lock);
+			return -1;
+		}
+		free(fonts.sets[lru].pattern);
+		if (fonts.sets[lru].fs) {
+			FcFontSetDestroy(fonts.sets[lru].fs);
+		}
+		if (fonts.sets[lru].fs_color) {
+			FcFontSetDestroy(fonts.sets[lru].fs_color);
+		}
+		// Evicted in place, slots of referenced sets must not move.
+		i = lru;
+	} else if (!found) {
+		fonts.len++;
+	}
+	if (!found) {
+		fonts.sets[i].pattern = strdup(pattern);
+		fonts.sets[i].fs = gp_load_font(fonts.config, (char *)pattern, false);
+		fonts.sets[i].fs_color =
+		        gp_load_font(fonts.config, (char *)pattern, true);
+		fonts.sets[i].refs = 0;
+	}
+	fonts.sets[i].used = ++fonts.tick;
+	bool ok = fonts.sets[i].fs != NULL;
+	if (ok) {
+		fonts.sets[i].refs++;
+		*fs = fonts.sets[i].fs;
+		*fs_color = fonts.sets[i].fs_color;
+	}
+	pthread_mutex_unlock(&fonts.lock);
+	return ok ? (int)i : -1;
+}
+
+// Runs point into the sets, release them once the runs are gone.
+static void fonts_release(int slot)
+{
+	pthread_mutex_lock(&fonts.lock);
+	fonts.sets[slot].refs--;
+	pthread_mutex_unlock(&fonts.lock);
+}
+
+static void reply(job *j, uint32_t status, int memfd, uint32_t size,
+                  uint32_t width, uint32_t height, uint32_t stride)
+{
+	gopand_reply r = {
+	        .id = j->id,
+	        .status = status,
+	        .kind = j->kind,
+	        .size = size,
+	        .width = width,
+	        .height = height,
+	        .stride = stride,
+	};
+	pthread_mutex_lock(&j->c->write_lock);
+	gopand_send_reply(j->c->fd, &r, status == GOPAND_OK ? memfd : -1);
+	pthread_mutex_unlock(&j->c->write_lock);
+	if (memfd >= 0) {
+		close(memfd);
+	}
+}
+
+// Shared memory the client maps after we pass it over the socket.
+static void *memfd_map(size_t size, int *memfd)
+{
+	*memfd = memfd_create("gopand", MFD_CLOEXEC);
+	if (*memfd < 0) {
+		return NULL;
+	}
+	void *addr = MAP_FAILED;
+	if (ftruncate(*memfd, size) == 0) {
+		addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, *memfd, 0);
+	}
+	if (addr == MAP_FAILED) {
+		close(*memfd);
+		*memfd = -1;
+		return NULL;
+	}
+	return addr;
+}
+
+static void finish_shape(job *j, gp_run_t *runs, uint32_t len)
+{
+	int memfd;
+	size_t size = gp_serialize(runs, len, NULL, 0);
+	uint8_t *data = size ? memfd_map(size, &memfd) : NULL;
+	if (!data) {
+		reply(j, GOPAND_FAILED, -1, 0, 0, 0, 0);
+		return;
+	}
+	gp_serialize(runs, len, data, size);
+	munmap(data, size);
+	reply(j, GOPAND_OK, memfd, size, 0, 0, 0);
+}
+
+static void finish_render(job *j, gp_run_t *runs, uint32_t len)
+{
+	double width, ascent, descent;
+	gp_measure(runs, len, &width, &ascent, &descent);
+	int w = (int)ceil(width) + 2 * GOPAND_PAD;
+	int h = (int)ceil(ascent + descent) + 2 * GOPAND_PAD;
+	int stride = cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, w);
+	size_t size = (size_t)stride * h;
+	int memfd;
+	uint8_t *data = memfd_map(size, &memfd);
+	if (!data) {
+		reply(j, GOPAND_FAILED, -1, 0, 0, 0, 0);
+		return;
+	}
+	// memfd pages start zeroed, ie. transparent.
+	cairo_surface_t *surface = cairo_image_surface_create_for_data(
+	        data, CAIRO_FORMAT_ARGB32, w, h, stride);
+	cairo_t *cr = cairo_create(surface);
+	gp_draw_cairo(cr, runs, len, GOPAND_PAD, GOPAND_PAD + ascent);
+	cairo_destroy(cr);
+	cairo_surface_flush(surface);
+	cairo_surface_destroy(surface);
+	munmap(data, size);
+	reply(j, GOPAND_OK, memfd, size, w, h, stride);
+}
+
+// All jobs share a pattern, analyze them in one gp_analyze_batch so per
+// font setup is paid once.
+static void process(job **jobs, uint32_t n)
+{
+	FcFontSet *fs, *fs_color;
+	int slot = fonts_for(jobs[0]->pattern, &fs, &fs_color);
+	if (slot < 0) {
+		for (uint32_t i = 0; i < n; i++) {
+			reply(jobs[i], GOPAND_NO_FONT, -1, 0, 0, 0, 0);
+		}
+		return;
+	}
+
+	// A rune of slack to catch texts over GOPAND_MAX_RUNES, those are
+	// refused rather than cut.
+	job *batch[GOPAND_BATCH];
+	gp_runes_t strings[GOPAND_BATCH];
+	uint32_t *runes = malloc(sizeof(uint32_t) * (GOPAND_MAX_RUNES + 1) * n);
+	uint32_t m = 0;
+	for (uint32_t i = 0; i < n; i++) {
+		strings[m].data = runes + (GOPAND_MAX_RUNES + 1) * m;
+		gp_utf8_to_runes(jobs[i]->text, strlen(jobs[i]->text),
+		                 GOPAND_MAX_RUNES + 1, strings[m].data,
+		                 &strings[m].len);
+		if (strings[m].len > GOPAND_MAX_RUNES) {
+			reply(jobs[i], GOPAND_BAD_REQUEST, -1, 0, 0, 0, 0);
+			continue;
+		}
+		batch[m++] = jobs[i];
+	}
+	jobs = batch;
+	n = m;
+	gp_batch_t out;
+	if (n == 0 || !gp_analyze_batch(strings, n, fs, fs_color, "en-US", &out)) {
+		for (uint32_t i = 0; i < n; i++) {
+			reply(jobs[i], GOPAND_FAILED, -1, 0, 0, 0, 0);
+		}
+		fonts_release(slot);
+		free(runes);
+		return;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		gp_run_t *runs = out.runs + out.offsets[i];
+		uint32_t len = out.offsets[i + 1] - out.offsets[i];
+		if (jobs[i]->kind == GOPAND_RENDER) {
+			finish_render(jobs[i], runs, len);
+		} else {
+			finish_shape(jobs[i], runs, len);
+		}
+	}
+	gp_batch_destroy(&out);
+	fonts_release(slot);
+	free(runes);
+}
+
+static void *worker(void *arg)
+{
+	(void)arg;
+	job *jobs[GOPAND_BATCH];
+	for (;;) {
+		pthread_mutex_lock(&queue.lock);
+		while (!queue.head) {
+			pthread_cond_wait(&queue.ready, &queue.lock);
+		}
+		// Take the oldest job and whatever else is queued for its pattern.
+		uint32_t n = 0;
+		job *prev = NULL;
+		for (job *j = queue.head; j && n < GOPAND_BATCH;) {
+			job *next = j->next;
+			if (n == 0 || strcmp(j->pattern, jobs[0]->pattern) == 0) {
+				jobs[n++] = j;
+				if (prev) {
+					prev->next = next;
+				} else {
+					queue.head = next;
+				}
+				if (queue.tail == j) {
+					queue.tail = prev;
+				}
+			} else {
+				prev = j;
+			}
+			j = next;
+		}
+		pthread_mutex_unlock(&queue.lock);
+
+		process(jobs, n);
+		for (uint32_t i = 0; i < n; i++) {
+			job_free(jobs[i]);
+		}
+	}
+	return NULL;
+}
+
+static char *read_string(int fd, uint32_t len)
+{
+	char *s = malloc(len + 1);
+	if (!gopand_read_full(fd, s, len)) {
+		free(s);
+		return NULL;
+	}
+	s[len] = '\0';
+	return s;
+}
+
+// Read requests off a connection until it closes or misbehaves.
+static void *reader(void *arg)
+{
+	conn *c = arg;
+	gopand_request req;
+	while (gopand_read_full(c->fd, &req, sizeof(req))) {
+		if (req.magic != GOPAND_MAGIC ||
+		    req.pattern_len > GOPAND_MAX_PATTERN ||
+		    req.text_len > GOPAND_MAX_TEXT) {
+			break;
+		}
+		job *j = calloc(1, sizeof(job));
+		j->c = c;
+		j->id = req.id;
+		j->kind = req.kind;
+		j->pattern = read_string(c->fd, req.pattern_len);
+		j->text = j->pattern ? read_string(c->fd, req.text_len) : NULL;
+		atomic_fetch_add(&c->refs, 1);
+		if (!j->text) {
+			job_free(j);
+			break;
+		}
+		if (req.kind != GOPAND_SHAPE && req.kind != GOPAND_RENDER) {
+			reply(j, GOPAND_BAD_REQUEST, -1, 0, 0, 0, 0);
+			job_free(j);
+			continue;
+		}
+
+		pthread_mutex_lock(&queue.lock);
+		if (queue.tail) {
+			queue.tail->next = j;
+		} else {
+			queue.head = j;
+		}
+		queue.tail = j;
+		pthread_cond_signal(&queue.ready);
+		pthread_mutex_unlock(&queue.lock);
+	}
+	// Stop reading, queued jobs still get their replies.
+	shutdown(c->fd, SHUT_RD);
+	conn_unref(c);
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	long threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int a = 1;
+	if (argc > 2 && strcmp(argv[1], "-j") == 0) {
+		threads = atol(argv[2]);
+		a = 3;
+	}
+	if (a + 1 != argc) {
+		printf("Call with gopand [-j threads] socket\n");
+		return 1;
+	}
+	signal(SIGPIPE, SIG_IGN);
+
+	fonts.config = FcConfigCreate();
+	if (FcConfigParseAndLoad(fonts.config, NULL, FcTrue) != FcTrue) {
+		printf("Failed to load fontconfig\n");
+		return -1;
+	}
+	FcConfigSetCurrent(fonts.config);
+	FcConfigBuildFonts(fonts.config);
+
+	struct sockaddr_un addr = {.sun_family = AF_UNIX};
+	if (strlen(argv[a]) >= sizeof(addr.sun_path)) {
+		printf("Socket path too long\n");
+		return 1;
+	}
+	strcpy(addr.sun_path, argv[a]);
+	int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	unlink(addr.sun_path);
+	if (sock < 0 || bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+	    listen(sock, 64) != 0) {
+		perror("Woops failed to listen");
+		return 1;
+	}
+
+	threads = threads > 0 ? threads : 1;
+	for (long i = 0; i < threads; i++) {
+		pthread_t t;
+		pthread_create(&t, NULL, worker, NULL);
+		pthread_detach(t);
+	}
+	printf("gopand listening on %s with %ld workers\n", argv[a], threads);
+
+	for (;;) {
+		int fd = accept4(sock, NULL, NULL, SOCK_CLOEXEC);
+		if (fd < 0) {
+			continue;
+		}
+		conn *c = calloc(1, sizeof(conn));
+		c->fd = fd;
+		atomic_init(&c->refs, 1);
+		pthread_mutex_init(&c->write_lock, NULL);
+		pthread_t t;
+		if (pthread_create(&t, NULL, reader, c) != 0) {
+			conn_unref(c);
+			continue;
+		}
+		pthread_detach(t);
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+#ifndef GP_HEADER_GOPAND_H
+#define GP_HEADER_GOPAND_H
+
+// Wire protocol of the gopand render daemon, shared with its clients.
+//
+// Clients connect to a SOCK_STREAM unix socket and write requests, a
+// gopand_request followed by pattern_len bytes of fontconfig pattern and
+// text_len bytes of utf8 text. Requests may be pipelined, replies come back
+// as they finish (not in order) and are matched by id. A reply is a
+// gopand_reply with, if status is GOPAND_OK, a memfd passed alongside it
+// holding size bytes: gp_serialize output for GOPAND_SHAPE, or premultiplied
+// ARGB32 pixels for GOPAND_RENDER.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#define GOPAND_MAGIC 0x44505047 // "GPPD"
+#define GOPAND_MAX_PATTERN 1024
+#define GOPAND_MAX_TEXT 65536
+
+enum gopand_kind {
+	GOPAND_SHAPE,
+	GOPAND_RENDER,
+};
+
+enum gopand_status {
+	GOPAND_OK,
+	GOPAND_BAD_REQUEST,
+	GOPAND_NO_FONT,
+	GOPAND_FAILED,
+};
+
+typedef struct gopand_request {
+	uint32_t magic;
+	uint32_t id;
+	uint32_t kind;
+	uint32_t pattern_len;
+	uint32_t text_len;
+} gopand_request;
+
+typedef struct gopand_reply {
+	uint32_t id;
+	uint32_t status;
+	uint32_t kind;
+	uint32_t size; // bytes in the memfd
+	uint32_t width; // GOPAND_RENDER only
+	uint32_t height;
+	uint32_t stride;
+} gopand_reply;
+
+static inline bool gopand_read_full(int fd, void *buf, size_t len)
+{
+	uint8_t *p = buf;
+	while (len) {
+		ssize_t n = read(fd, p, len);
+		if (n <= 0) {
+			return false;
+		}
+		p += n;
+		len -= n;
+	}
+	return true;
+}
+
+static inline bool gopand_write_full(int fd, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+	while (len) {
+		ssize_t n = write(fd, p, len);
+		if (n <= 0) {
+			return false;
+		}
+		p += n;
+		len -= n;
+	}
+	return true;
+}
+
+// Send reply, with memfd attached unless it is negative.
+static inline bool gopand_send_reply(int sock, const gopand_reply *reply,
+                                     int memfd)
+{
+	struct iovec iov = {(void *)reply, sizeof(*reply)};
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(sizeof(int))];
+	} ctl;
+	struct msghdr msg = {.msg_iov = &iov, .msg_iovlen = 1};
+	if (memfd >= 0) {
+		msg.msg_control = ctl.buf;
+		msg.msg_controllen = sizeof(ctl.buf);
+		struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+		c->cmsg_level = SOL_SOCKET;
+		c->cmsg_type = SCM_RIGHTS;
+		c->cmsg_len = CMSG_LEN(sizeof(int));
+		memcpy(CMSG_DATA(c), &memfd, sizeof(int));
+	}
+	// The reply is small enough that a stream socket sends it whole.
+	return sendmsg(sock, &msg, MSG_NOSIGNAL) == sizeof(*reply);
+}
+
+// Receive a reply and its memfd (-1 if none).
+static inline bool gopand_recv_reply(int sock, gopand_reply *reply,
+                                     int *memfd)
+{
+	struct iovec iov = {reply, sizeof(*reply)};
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(sizeof(int))];
+	} ctl;
+	struct msghdr msg = {
+	        .msg_iov = &iov,
+	        .msg_iovlen = 1,
+	        .msg_control = ctl.buf,
+	        .msg_controllen = sizeof(ctl.buf),
+	};
+	*memfd = -1;
+	ssize_t n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+	if (n <= 0) {
+		return false;
+	}
+	struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+	if (c && c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_RIGHTS) {
+		memcpy(memfd, CMSG_DATA(c), sizeof(int));
+	}
+	// The fd arrives with the first byte, the rest may trail behind.
+	return gopand_read_full(sock, (uint8_t *)reply + n, sizeof(*reply) - n);
+}
+
+#endif